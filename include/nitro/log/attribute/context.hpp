@@ -0,0 +1,211 @@
+/*
+ * Copyright (c) 2026, Technische Universität Dresden, Germany
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted
+ * provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+ *    and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to
+ *    endorse or promote products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ * WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef INCLUDE_NITRO_LOG_CONTEXT_ATTRIBUTE_HPP
+#define INCLUDE_NITRO_LOG_CONTEXT_ATTRIBUTE_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace nitro
+{
+namespace log
+{
+    typedef std::vector<std::pair<std::string, std::string>> context_entries;
+
+    namespace detail
+    {
+        /**
+         * @brief Thread-local stack of key/value pairs.
+         *
+         * Every push and pop gets a new, process-wide unique generation. Copies of the entries
+         * are only made on request and then shared by all records of the same generation.
+         */
+        class context_stack
+        {
+        public:
+            static context_stack& instance()
+            {
+                static thread_local context_stack stack;
+                return stack;
+            }
+
+            void push(std::string key, std::string value)
+            {
+                entries_.emplace_back(std::move(key), std::move(value));
+                advance();
+            }
+
+            void pop()
+            {
+                entries_.pop_back();
+                advance();
+            }
+
+            const context_entries& entries() const
+            {
+                return entries_;
+            }
+
+            std::uint64_t generation() const
+            {
+                return generation_;
+            }
+
+            std::shared_ptr<const context_entries> snapshot()
+            {
+                if (!snapshot_)
+                {
+                    snapshot_ = std::make_shared<const context_entries>(entries_);
+                }
+
+                return snapshot_;
+            }
+
+        private:
+            context_stack() : generation_(next_generation())
+            {
+            }
+
+            void advance()
+            {
+                generation_ = next_generation();
+                snapshot_.reset();
+            }
+
+            static std::uint64_t next_generation()
+            {
+                static std::atomic<std::uint64_t> generation{ 0 };
+                return ++generation;
+            }
+
+        private:
+            context_entries entries_;
+            std::uint64_t generation_;
+            std::shared_ptr<const context_entries> snapshot_;
+        };
+    } // namespace detail
+
+    /**
+     * @brief RAII guard, which adds a key/value pair to the logging context of the current thread
+     * for its lifetime.
+     */
+    class context_guard
+    {
+    public:
+        context_guard(std::string key, std::string value)
+        {
+            detail::context_stack::instance().push(std::move(key), std::move(value));
+        }
+
+        context_guard(const context_guard&) = delete;
+        context_guard& operator=(const context_guard&) = delete;
+
+        ~context_guard()
+        {
+            detail::context_stack::instance().pop();
+        }
+    };
+
+    /**
+     * @brief Attribute for the logging context of the thread, which created the record.
+     *
+     * On creation, only the generation of the thread's context stack is stored. Copying the
+     * record or calling detach() copies the entries, which is required if the record is
+     * formatted after the context changed or on a different thread. Otherwise, context() returns
+     * an empty context in that case.
+     */
+    class context_attribute
+    {
+    public:
+        context_attribute()
+        : stack_(&detail::context_stack::instance()), generation_(stack_->generation())
+        {
+        }
+
+        context_attribute(const context_attribute& other)
+        : stack_(other.stack_), generation_(other.generation_), copy_(other.copy_)
+        {
+            detach();
+        }
+
+        context_attribute& operator=(const context_attribute& other)
+        {
+            stack_ = other.stack_;
+            generation_ = other.generation_;
+            copy_ = other.copy_;
+            detach();
+
+            return *this;
+        }
+
+        const context_entries& context() const
+        {
+            if (copy_)
+            {
+                return *copy_;
+            }
+
+            if (live())
+            {
+                return stack_->entries();
+            }
+
+            static const context_entries empty;
+            return empty;
+        }
+
+        void detach()
+        {
+            if (!copy_ && live())
+            {
+                copy_ = stack_->snapshot();
+            }
+        }
+
+    private:
+        bool live() const
+        {
+            // compare the address first, stack_ may belong to a thread, which has already ended
+            return stack_ == &detail::context_stack::instance() &&
+                   stack_->generation() == generation_;
+        }
+
+    private:
+        detail::context_stack* stack_;
+        std::uint64_t generation_;
+        std::shared_ptr<const context_entries> copy_;
+    };
+} // namespace log
+} // namespace nitro
+
+#endif // INCLUDE_NITRO_LOG_CONTEXT_ATTRIBUTE_HPP
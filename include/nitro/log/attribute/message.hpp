@@ -29,26 +29,32 @@
 #ifndef INCLUDE_NITRO_LOG_MESSAGE_ATTRIBUTE_HPP
 #define INCLUDE_NITRO_LOG_MESSAGE_ATTRIBUTE_HPP
 
-#include <string>
+#include <nitro/log/inline_string.hpp>
+
+#ifndef NITRO_LOG_MESSAGE_INLINE_CAPACITY
+#define NITRO_LOG_MESSAGE_INLINE_CAPACITY 128
+#endif
 
 namespace nitro
 {
 namespace log
 {
 
+    using message_string = basic_inline_string<NITRO_LOG_MESSAGE_INLINE_CAPACITY>;
+
     class message_attribute
     {
-        std::string m_message;
+        message_string m_message;
 
     public:
         message_attribute() = default;
 
-        std::string message() const
+        const message_string& message() const
         {
             return m_message;
         }
 
-        std::string& message()
+        message_string& message()
         {
             return m_message;
         }
@@ -0,0 +1,257 @@
+/*
+ * Copyright (c) 2026, Technische Universität Dresden, Germany
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted
+ * provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+ *    and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to
+ *    endorse or promote products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ * WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef INCLUDE_NITRO_LOG_STACKTRACE_ATTRIBUTE_HPP
+#define INCLUDE_NITRO_LOG_STACKTRACE_ATTRIBUTE_HPP
+
+#include <nitro/log/severity.hpp>
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+
+#include <cxxabi.h>
+
+extern "C"
+{
+#include <dlfcn.h>
+#include <execinfo.h>
+}
+
+namespace nitro
+{
+namespace log
+{
+    namespace detail
+    {
+        struct frame_symbol
+        {
+            // e.g. "foo(int)+0x1a (libfoo.so)"
+            std::string name;
+            // whether the frame belongs to the logger itself, which skips it in stack traces
+            bool internal;
+        };
+
+        /**
+         * @brief Process-wide cache of the symbol names of return addresses.
+         */
+        class symbol_cache
+        {
+        public:
+            static symbol_cache& instance()
+            {
+                static symbol_cache cache;
+                return cache;
+            }
+
+            const frame_symbol& symbolize(void* address)
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+
+                auto it = symbols_.find(address);
+                if (it == symbols_.end())
+                {
+                    it = symbols_.emplace(address, resolve(address)).first;
+                }
+
+                return it->second;
+            }
+
+            std::size_t size()
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                return symbols_.size();
+            }
+
+        private:
+            static frame_symbol resolve(void* address)
+            {
+                Dl_info info;
+                std::memset(&info, 0, sizeof(info));
+
+                char buffer[32];
+                std::string result;
+                bool internal = false;
+
+                if (::dladdr(address, &info) == 0)
+                {
+                    std::snprintf(buffer, sizeof(buffer), "%p", address);
+                    return { buffer, false };
+                }
+
+                if (info.dli_sname != nullptr)
+                {
+                    int status = 0;
+                    std::unique_ptr<char, void (*)(void*)> demangled(
+                        abi::__cxa_demangle(info.dli_sname, nullptr, nullptr, &status), std::free);
+
+                    result = status == 0 ? demangled.get() : info.dli_sname;
+
+                    // the function itself is in nitro::log, not only a template argument
+                    auto pos = result.find("nitro::log::");
+                    internal = pos != std::string::npos && pos < result.find_first_of("<(");
+
+                    std::snprintf(buffer, sizeof(buffer), "+0x%zx",
+                                  static_cast<std::size_t>(static_cast<char*>(address) -
+                                                           static_cast<char*>(info.dli_saddr)));
+                    result += buffer;
+                }
+                else
+                {
+                    std::snprintf(buffer, sizeof(buffer), "%p", address);
+                    result = buffer;
+                }
+
+                if (info.dli_fname != nullptr)
+                {
+                    auto name = std::strrchr(info.dli_fname, '/');
+                    result += " (";
+                    result += name != nullptr ? name + 1 : info.dli_fname;
+                    result += ")";
+                }
+
+                return { result, internal };
+            }
+
+        private:
+            std::mutex mutex_;
+            std::unordered_map<void*, frame_symbol> symbols_;
+        };
+    } // namespace detail
+
+    /**
+     * @brief Return addresses of a call stack, which are only symbolized when written.
+     */
+    class stacktrace
+    {
+    public:
+        static constexpr int max_frames = 32;
+
+        // skips the given number of innermost frames (at most 7) in addition to capture() itself
+        void capture(int skip = 0)
+        {
+            // frames skipped at most, including capture() itself
+            const int max_skip = 8;
+
+            void* frames[max_frames + max_skip];
+            skip = skip < max_skip - 1 ? skip + 1 : max_skip;
+
+            auto size = ::backtrace(frames, max_frames + skip);
+
+            size_ = size > skip ? size - skip : 0;
+            std::memcpy(frames_, frames + skip, size_ * sizeof(void*));
+        }
+
+        int size() const
+        {
+            return size_;
+        }
+
+        bool empty() const
+        {
+            return size_ == 0;
+        }
+
+        void* operator[](int index) const
+        {
+            return frames_[index];
+        }
+
+        // the frame lines, each starting with a newline, the innermost frames of the logger
+        // itself are skipped
+        template <typename Stream>
+        void write(Stream& s) const
+        {
+            auto& cache = detail::symbol_cache::instance();
+            int i = 0;
+
+            while (i < size_ && cache.symbolize(frames_[i]).internal)
+            {
+                ++i;
+            }
+
+            for (int frame = 0; i < size_; ++i, ++frame)
+            {
+                s << "\n  #" << frame << " " << cache.symbolize(frames_[i]).name;
+            }
+        }
+
+    private:
+        void* frames_[max_frames];
+        int size_ = 0;
+    };
+
+    inline std::ostream& operator<<(std::ostream& s, const stacktrace& trace)
+    {
+        trace.write(s);
+        return s;
+    }
+
+    /**
+     * @brief Attribute capturing the call stack of records with at least min_severity().
+     *
+     * Capturing only stores the raw return addresses. The symbol names are resolved with
+     * dladdr() when the stack trace is written and cached for the whole process. Functions of
+     * the executable itself only have names, if it was linked with -rdynamic. Frames of the
+     * logger are recognized by their names, so they remain in traces without symbols.
+     */
+    class stacktrace_attribute
+    {
+    public:
+        static severity_level& min_severity()
+        {
+            static severity_level sev = severity_level::error;
+            return sev;
+        }
+
+        const class stacktrace& stacktrace() const
+        {
+            return trace_;
+        }
+
+        // called by the log stream for enabled records
+        void capture_stacktrace(severity_level sev)
+        {
+            if (sev >= min_severity())
+            {
+                trace_.capture();
+            }
+        }
+
+    private:
+        class stacktrace trace_;
+    };
+} // namespace log
+} // namespace nitro
+
+#endif // INCLUDE_NITRO_LOG_STACKTRACE_ATTRIBUTE_HPP
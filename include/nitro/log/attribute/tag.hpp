@@ -29,26 +29,28 @@
 #ifndef INCLUDE_NITRO_LOG_TAG_ATTRIBUTE_HPP
 #define INCLUDE_NITRO_LOG_TAG_ATTRIBUTE_HPP
 
-#include <string>
+#include <nitro/log/inline_string.hpp>
 
 namespace nitro
 {
 namespace log
 {
 
+    using tag_string = basic_inline_string<32>;
+
     class tag_attribute
     {
-        std::string m_tag;
+        tag_string m_tag;
 
     public:
         tag_attribute() = default;
 
-        std::string tag() const
+        const tag_string& tag() const
         {
             return m_tag;
         }
 
-        std::string& tag()
+        tag_string& tag()
         {
             return m_tag;
         }
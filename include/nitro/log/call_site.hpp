@@ -0,0 +1,384 @@
+/*
+ * Copyright (c) 2026, Technische Universität Dresden, Germany
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted
+ * provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+ *    and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to
+ *    endorse or promote products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ * WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef INCLUDE_NITRO_LOG_CALL_SITE_HPP
+#define INCLUDE_NITRO_LOG_CALL_SITE_HPP
+
+#include <nitro/log/severity.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace nitro
+{
+namespace log
+{
+    namespace detail
+    {
+        inline std::atomic<bool>& call_site_stats_flag()
+        {
+            static std::atomic<bool> enabled{ false };
+            return enabled;
+        }
+
+        inline bool call_site_stats_enabled()
+        {
+            return call_site_stats_flag().load(std::memory_order_relaxed);
+        }
+    } // namespace detail
+
+    /**
+     * @brief Static descriptor of a single log statement, see NITRO_LOG().
+     *
+     * Call sites are constant initialized, so checking one costs a relaxed atomic load and a
+     * branch. They register themselves in the call_site_registry when they are used first.
+     */
+    class call_site
+    {
+        enum state : int
+        {
+            unregistered,
+            enabled_state,
+            disabled_state
+        };
+
+    public:
+        constexpr call_site(const char* file, int line, const char* tag,
+                            severity_level severity) noexcept
+        : file_(file), line_(line), tag_(tag), severity_(severity), state_(unregistered),
+          emitted_(0), filtered_(0), bytes_(0), nanoseconds_(0)
+        {
+        }
+
+        call_site(const call_site&) = delete;
+        call_site& operator=(const call_site&) = delete;
+
+        bool enabled() noexcept
+        {
+            auto state = state_.load(std::memory_order_relaxed);
+
+            if (state == disabled_state)
+            {
+                return false;
+            }
+
+            if (state == unregistered)
+            {
+                return register_site();
+            }
+
+            return true;
+        }
+
+        void enable(bool enabled) noexcept
+        {
+            state_.store(enabled ? enabled_state : disabled_state, std::memory_order_relaxed);
+        }
+
+        const char* file() const noexcept
+        {
+            return file_;
+        }
+
+        int line() const noexcept
+        {
+            return line_;
+        }
+
+        const char* tag() const noexcept
+        {
+            return tag_;
+        }
+
+        severity_level severity() const noexcept
+        {
+            return severity_;
+        }
+
+        // counters of the call site, only updated while enable_call_site_stats() is set
+
+        std::uint64_t emitted() const noexcept
+        {
+            return emitted_.load(std::memory_order_relaxed);
+        }
+
+        // records rejected by the filter or by disabling the call site
+        std::uint64_t filtered() const noexcept
+        {
+            return filtered_.load(std::memory_order_relaxed);
+        }
+
+        std::uint64_t bytes() const noexcept
+        {
+            return bytes_.load(std::memory_order_relaxed);
+        }
+
+        // time spent in formatting the records and passing them to the sink
+        std::chrono::nanoseconds time() const noexcept
+        {
+            return std::chrono::nanoseconds(nanoseconds_.load(std::memory_order_relaxed));
+        }
+
+        void count_filtered() noexcept
+        {
+            filtered_.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        void count_emitted(std::size_t bytes, std::chrono::nanoseconds time) noexcept
+        {
+            emitted_.fetch_add(1, std::memory_order_relaxed);
+            bytes_.fetch_add(bytes, std::memory_order_relaxed);
+            nanoseconds_.fetch_add(static_cast<std::uint64_t>(time.count()),
+                                   std::memory_order_relaxed);
+        }
+
+    private:
+        friend class call_site_registry;
+
+        inline bool register_site();
+
+        const char* file_;
+        int line_;
+        const char* tag_;
+        severity_level severity_;
+        std::atomic<int> state_;
+        call_site* next_ = nullptr;
+
+        std::atomic<std::uint64_t> emitted_;
+        std::atomic<std::uint64_t> filtered_;
+        std::atomic<std::uint64_t> bytes_;
+        std::atomic<std::uint64_t> nanoseconds_;
+    };
+
+    /**
+     * @brief Registry of all call sites used so far, which allows to enable or disable them by
+     * file, line or tag at runtime.
+     *
+     * Rules are kept and also applied to call sites registered later on. If several rules match
+     * a call site, the one added last wins. Files match if the given name is the file name of a
+     * call site or a trailing part of its path, e.g. "src/foo.cpp".
+     */
+    class call_site_registry
+    {
+        struct rule
+        {
+            std::string file;
+            int line;
+            std::string tag;
+            bool match_tag;
+            bool enable;
+        };
+
+    public:
+        static call_site_registry& instance()
+        {
+            static call_site_registry registry;
+            return registry;
+        }
+
+        void enable_file(const std::string& file, bool enable)
+        {
+            add_rule({ file, 0, std::string(), false, enable });
+        }
+
+        void enable_line(const std::string& file, int line, bool enable)
+        {
+            add_rule({ file, line, std::string(), false, enable });
+        }
+
+        void enable_tag(const std::string& tag, bool enable)
+        {
+            add_rule({ std::string(), 0, tag, true, enable });
+        }
+
+        // removes all rules and enables every call site again
+        void reset()
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+
+            rules_.clear();
+
+            for (auto site = head_; site != nullptr; site = site->next_)
+            {
+                site->enable(true);
+            }
+        }
+
+        void reset_stats()
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+
+            for (auto site = head_; site != nullptr; site = site->next_)
+            {
+                site->emitted_.store(0, std::memory_order_relaxed);
+                site->filtered_.store(0, std::memory_order_relaxed);
+                site->bytes_.store(0, std::memory_order_relaxed);
+                site->nanoseconds_.store(0, std::memory_order_relaxed);
+            }
+        }
+
+        template <typename Function>
+        void for_each(Function f)
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+
+            for (auto site = head_; site != nullptr; site = site->next_)
+            {
+                f(*site);
+            }
+        }
+
+    private:
+        friend class call_site;
+
+        call_site_registry() = default;
+
+        static bool ends_with_path(const char* path, const std::string& file)
+        {
+            auto path_size = std::strlen(path);
+
+            if (file.empty() || file.size() > path_size)
+            {
+                return false;
+            }
+
+            auto tail = path + path_size - file.size();
+
+            return file == tail && (tail == path || tail[-1] == '/' || tail[-1] == '\\');
+        }
+
+        static bool matches(const rule& r, const call_site& site)
+        {
+            if (r.match_tag)
+            {
+                return site.tag() != nullptr && r.tag == site.tag();
+            }
+
+            return ends_with_path(site.file(), r.file) && (r.line == 0 || r.line == site.line());
+        }
+
+        // requires mutex_ to be locked
+        void apply_rules(call_site& site)
+        {
+            bool enable = true;
+
+            for (auto& r : rules_)
+            {
+                if (matches(r, site))
+                {
+                    enable = r.enable;
+                }
+            }
+
+            site.enable(enable);
+        }
+
+        void add_rule(rule r)
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+
+            rules_.emplace_back(std::move(r));
+
+            for (auto site = head_; site != nullptr; site = site->next_)
+            {
+                if (matches(rules_.back(), *site))
+                {
+                    site->enable(rules_.back().enable);
+                }
+            }
+        }
+
+        bool add(call_site& site)
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+
+            // another thread might have been faster
+            if (site.state_.load(std::memory_order_relaxed) == call_site::unregistered)
+            {
+                site.next_ = head_;
+                head_ = &site;
+
+                apply_rules(site);
+            }
+
+            return site.state_.load(std::memory_order_relaxed) == call_site::enabled_state;
+        }
+
+    private:
+        std::mutex mutex_;
+        call_site* head_ = nullptr;
+        std::vector<rule> rules_;
+    };
+
+    inline bool call_site::register_site()
+    {
+        return call_site_registry::instance().add(*this);
+    }
+} // namespace log
+} // namespace nitro
+
+/**
+ * Logs with the given logger and severity through a call site of its own, e.g.
+ * NITRO_LOG(logging, info) << "message". If the call site was disabled in the registry, neither
+ * a record is created nor the filter of the logger is called.
+ */
+#define NITRO_LOG(Logger, Severity) NITRO_LOG_TAGGED(Logger, Severity, nullptr)
+
+/**
+ * Like NITRO_LOG(), but with a tag, which has to be a string literal.
+ */
+#define NITRO_LOG_TAGGED(Logger, Severity, Tag)                                                    \
+    Logger::Severity(NITRO_LOG_CALL_SITE(Severity, Tag))
+
+/**
+ * Like NITRO_LOG(), but for a basic_logger object instead of a logger type, e.g.
+ * NITRO_LOG_INSTANCE(my_logger, info) << "message".
+ */
+#define NITRO_LOG_INSTANCE(Instance, Severity)                                                     \
+    NITRO_LOG_INSTANCE_TAGGED(Instance, Severity, nullptr)
+
+/**
+ * Like NITRO_LOG_INSTANCE(), but with a tag, which has to be a string literal.
+ */
+#define NITRO_LOG_INSTANCE_TAGGED(Instance, Severity, Tag)                                         \
+    (Instance).Severity(NITRO_LOG_CALL_SITE(Severity, Tag))
+
+// the call site of the line the macro is expanded in
+#define NITRO_LOG_CALL_SITE(Severity, Tag)                                                         \
+    []() -> ::nitro::log::call_site& {                                                             \
+        static ::nitro::log::call_site nitro_log_site(__FILE__, __LINE__, Tag,                     \
+                                                      ::nitro::log::severity_level::Severity);     \
+        return nitro_log_site;                                                                     \
+    }()
+
+#endif // INCLUDE_NITRO_LOG_CALL_SITE_HPP
@@ -0,0 +1,194 @@
+/*
+ * Copyright (c) 2026, Technische Universität Dresden, Germany
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted
+ * provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+ *    and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to
+ *    endorse or promote products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ * WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef INCLUDE_NITRO_LOG_CALL_SITE_REPORT_HPP
+#define INCLUDE_NITRO_LOG_CALL_SITE_REPORT_HPP
+
+#include <nitro/log/call_site.hpp>
+#include <nitro/log/severity.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace nitro
+{
+namespace log
+{
+    enum class call_site_order
+    {
+        bytes,
+        records,
+        time,
+        filtered
+    };
+
+    struct call_site_entry
+    {
+        const char* file;
+        int line;
+        const char* tag;
+        severity_level severity;
+
+        std::uint64_t emitted;
+        std::uint64_t filtered;
+        std::uint64_t bytes;
+        std::chrono::nanoseconds time;
+    };
+
+    /**
+     * @brief Snapshot of the counters of all call sites, which were used so far, sorted by the
+     * given order with the most expensive call site first.
+     */
+    inline std::vector<call_site_entry> call_site_report(call_site_order order =
+                                                             call_site_order::bytes)
+    {
+        std::vector<call_site_entry> entries;
+
+        call_site_registry::instance().for_each([&entries](const call_site& site) {
+            entries.push_back({ site.file(), site.line(), site.tag(), site.severity(),
+                                site.emitted(), site.filtered(), site.bytes(), site.time() });
+        });
+
+        auto key = [order](const call_site_entry& entry) -> std::uint64_t {
+            switch (order)
+            {
+            case call_site_order::records:
+                return entry.emitted;
+            case call_site_order::time:
+                return static_cast<std::uint64_t>(entry.time.count());
+            case call_site_order::filtered:
+                return entry.filtered;
+            case call_site_order::bytes:
+            default:
+                return entry.bytes;
+            }
+        };
+
+        std::stable_sort(entries.begin(), entries.end(),
+                         [&key](const call_site_entry& a, const call_site_entry& b) {
+                             return key(a) > key(b);
+                         });
+
+        return entries;
+    }
+
+    inline std::ostream& operator<<(std::ostream& s, const std::vector<call_site_entry>& entries)
+    {
+        s << std::setw(12) << "emitted" << std::setw(12) << "filtered" << std::setw(14) << "bytes"
+          << std::setw(14) << "time [us]"
+          << "  severity  site\n";
+
+        for (auto& entry : entries)
+        {
+            s << std::setw(12) << entry.emitted << std::setw(12) << entry.filtered
+              << std::setw(14) << entry.bytes << std::setw(14)
+              << std::chrono::duration_cast<std::chrono::microseconds>(entry.time).count() << "  "
+              << entry.severity << "     " << entry.file << ':' << entry.line;
+
+            if (entry.tag != nullptr)
+            {
+                s << " [" << entry.tag << ']';
+            }
+
+            s << '\n';
+        }
+
+        return s;
+    }
+
+    /**
+     * @brief Enables or disables the counters of the call sites, which are disabled by default.
+     *
+     * Only log statements with a call site, i.e., NITRO_LOG() and NITRO_LOG_TAGGED(), are
+     * counted. While disabled, it costs a relaxed atomic load per statement.
+     */
+    inline void enable_call_site_stats(bool enable = true)
+    {
+        detail::call_site_stats_flag().store(enable, std::memory_order_relaxed);
+    }
+
+    inline void reset_call_site_stats()
+    {
+        call_site_registry::instance().reset_stats();
+    }
+
+    /**
+     * @brief Writes the call_site_report() to the stream.
+     */
+    inline void dump_call_site_report(std::ostream& s = std::cerr,
+                                      call_site_order order = call_site_order::bytes)
+    {
+        s << call_site_report(order);
+    }
+
+    namespace detail
+    {
+        class call_site_report_at_exit
+        {
+        public:
+            call_site_report_at_exit(std::ostream& s, call_site_order order)
+            : stream_(&s), order_(order)
+            {
+            }
+
+            ~call_site_report_at_exit()
+            {
+                dump_call_site_report(*stream_, order_);
+            }
+
+            std::ostream* stream_;
+            call_site_order order_;
+        };
+    } // namespace detail
+
+    /**
+     * @brief Enables the call site stats and writes the report to the stream at exit, the
+     * stream has to stay valid until then. Later calls only change the stream and order.
+     */
+    inline void dump_call_site_report_at_exit(std::ostream& s = std::cerr,
+                                              call_site_order order = call_site_order::bytes)
+    {
+        // the registry is destroyed after the report
+        call_site_registry::instance();
+
+        static detail::call_site_report_at_exit report(s, order);
+        report.stream_ = &s;
+        report.order_ = order;
+
+        enable_call_site_stats();
+    }
+} // namespace log
+} // namespace nitro
+
+#endif // INCLUDE_NITRO_LOG_CALL_SITE_REPORT_HPP
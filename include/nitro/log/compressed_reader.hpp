@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2026, Technische Universität Dresden, Germany
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted
+ * provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+ *    and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to
+ *    endorse or promote products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ * WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef INCLUDE_NITRO_LOG_COMPRESSED_READER_HPP
+#define INCLUDE_NITRO_LOG_COMPRESSED_READER_HPP
+
+#include <nitro/log/detail/crc32c.hpp>
+#include <nitro/log/detail/lz4_block.hpp>
+#include <nitro/log/detail/mapped_file.hpp>
+#include <nitro/log/sink/compressed_logfile.hpp>
+
+#include <nitro/except/raise.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace nitro
+{
+namespace log
+{
+    /**
+     * @brief Reads the log files written by sink::CompressedLogfile.
+     *
+     * A truncated chunk at the end of the file, e.g. after a crash, is ignored. Reading chunks
+     * is thread-safe, so they can be decompressed in parallel.
+     */
+    class compressed_log_reader
+    {
+    public:
+        struct chunk
+        {
+            std::size_t offset;
+            compressed_chunk_header header;
+        };
+
+        explicit compressed_log_reader(const std::string& file_name) : file_(file_name)
+        {
+            compressed_log_header header;
+
+            if (file_.size() < sizeof(header))
+            {
+                raise("Invalid compressed log file: ", file_name);
+            }
+
+            std::memcpy(&header, file_.data(), sizeof(header));
+
+            if (std::memcmp(header.magic, compressed_log_header::magic_value(),
+                            sizeof(header.magic)) != 0 ||
+                header.version != compressed_log_header::version_value ||
+                header.chunk_header_size != sizeof(compressed_chunk_header))
+            {
+                raise("Invalid compressed log file: ", file_name);
+            }
+
+            std::size_t offset = sizeof(header);
+
+            while (file_.size() - offset >= sizeof(compressed_chunk_header))
+            {
+                chunk c;
+                c.offset = offset + sizeof(compressed_chunk_header);
+                std::memcpy(&c.header, file_.data() + offset, sizeof(c.header));
+
+                if (c.header.magic != compressed_chunk_header::magic_value)
+                {
+                    raise("Invalid chunk header at offset ", offset, " in ", file_name);
+                }
+
+                if (file_.size() - c.offset < c.header.stored_size)
+                {
+                    break;
+                }
+
+                chunks_.push_back(c);
+                offset = c.offset + c.header.stored_size;
+            }
+
+            file_.sequential();
+        }
+
+        const std::vector<chunk>& chunks() const
+        {
+            return chunks_;
+        }
+
+        // decompresses the chunk into data and verifies its checksum
+        void read(std::size_t index, std::string& data) const
+        {
+            auto& c = chunks_.at(index);
+            auto stored = file_.data() + c.offset;
+
+            data.resize(c.header.size);
+
+            if (c.header.flags & compressed_chunk_header::compressed)
+            {
+                if (!detail::lz4_block::decompress(stored, c.header.stored_size, &data[0],
+                                                   data.size()))
+                {
+                    raise("Corrupt data in chunk ", index);
+                }
+            }
+            else if (c.header.stored_size == c.header.size)
+            {
+                std::memcpy(&data[0], stored, data.size());
+            }
+            else
+            {
+                raise("Corrupt header of chunk ", index);
+            }
+
+            if (detail::crc32c(data.data(), data.size()) != c.header.crc)
+            {
+                raise("Checksum mismatch in chunk ", index);
+            }
+        }
+
+        // writes all chunks overlapping with the time range [from, to] to the output
+        void read_all(std::ostream& output,
+                      std::int64_t from = std::numeric_limits<std::int64_t>::min(),
+                      std::int64_t to = std::numeric_limits<std::int64_t>::max()) const
+        {
+            std::string data;
+
+            for (std::size_t i = 0; i < chunks_.size(); ++i)
+            {
+                auto& header = chunks_[i].header;
+
+                if (header.last_timestamp < from || header.first_timestamp > to)
+                {
+                    continue;
+                }
+
+                read(i, data);
+                output.write(data.data(), data.size());
+            }
+        }
+
+    private:
+        detail::mapped_file file_;
+        std::vector<chunk> chunks_;
+    };
+} // namespace log
+} // namespace nitro
+
+#endif // INCLUDE_NITRO_LOG_COMPRESSED_READER_HPP
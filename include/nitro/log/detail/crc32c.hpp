@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2026, Technische Universität Dresden, Germany
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted
+ * provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+ *    and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to
+ *    endorse or promote products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ * WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef INCLUDE_NITRO_LOG_DETAIL_CRC32C_HPP
+#define INCLUDE_NITRO_LOG_DETAIL_CRC32C_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__SSE4_2__)
+#include <nmmintrin.h>
+#endif
+
+namespace nitro
+{
+namespace log
+{
+    namespace detail
+    {
+        /**
+         * @brief Computes the CRC-32C (Castagnoli) of the data, using the SSE 4.2 instruction if
+         * available at compile time.
+         */
+        inline std::uint32_t crc32c(const void* data, std::size_t size, std::uint32_t crc = 0)
+        {
+            auto bytes = static_cast<const unsigned char*>(data);
+            crc = ~crc;
+
+#if defined(__SSE4_2__) && defined(__x86_64__)
+            for (; size >= 8; size -= 8, bytes += 8)
+            {
+                std::uint64_t word;
+                std::memcpy(&word, bytes, sizeof(word));
+                crc = static_cast<std::uint32_t>(_mm_crc32_u64(crc, word));
+            }
+
+            for (; size > 0; --size, ++bytes)
+            {
+                crc = _mm_crc32_u8(crc, *bytes);
+            }
+#else
+            static const std::array<std::uint32_t, 256> table = []() {
+                std::array<std::uint32_t, 256> result;
+
+                for (std::uint32_t i = 0; i < 256; ++i)
+                {
+                    std::uint32_t value = i;
+                    for (int bit = 0; bit < 8; ++bit)
+                    {
+                        value = (value >> 1) ^ ((value & 1) ? 0x82f63b78u : 0);
+                    }
+                    result[i] = value;
+                }
+
+                return result;
+            }();
+
+            for (; size > 0; --size, ++bytes)
+            {
+                crc = table[(crc ^ *bytes) & 0xff] ^ (crc >> 8);
+            }
+#endif
+
+            return ~crc;
+        }
+    } // namespace detail
+} // namespace log
+} // namespace nitro
+
+#endif // INCLUDE_NITRO_LOG_DETAIL_CRC32C_HPP
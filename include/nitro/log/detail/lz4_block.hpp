@@ -0,0 +1,271 @@
+/*
+ * Copyright (c) 2026, Technische Universität Dresden, Germany
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted
+ * provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+ *    and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to
+ *    endorse or promote products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ * WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef INCLUDE_NITRO_LOG_DETAIL_LZ4_BLOCK_HPP
+#define INCLUDE_NITRO_LOG_DETAIL_LZ4_BLOCK_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace nitro
+{
+namespace log
+{
+    namespace detail
+    {
+        /**
+         * @brief Minimal compressor for the LZ4 block format.
+         *
+         * It uses a single hash table and greedy matching, which is good enough for the highly
+         * repetitive content of log files. The output can be decompressed by any LZ4
+         * implementation and vice versa.
+         */
+        class lz4_block
+        {
+            static constexpr std::size_t min_match = 4;
+            static constexpr std::size_t last_literals = 5;
+            static constexpr std::size_t mf_limit = 12;
+            static constexpr unsigned hash_log = 12;
+
+        public:
+            static std::size_t bound(std::size_t size)
+            {
+                return size + size / 255 + 16;
+            }
+
+            // requires bound(size) bytes at dest, returns the compressed size
+            std::size_t compress(const char* source, std::size_t size, char* dest)
+            {
+                auto src = reinterpret_cast<const unsigned char*>(source);
+                auto op = reinterpret_cast<unsigned char*>(dest);
+                std::size_t anchor = 0;
+
+                if (size > mf_limit)
+                {
+                    std::fill(table_.begin(), table_.end(), 0);
+
+                    auto limit = size - mf_limit;
+                    auto match_limit = size - last_literals;
+
+                    for (std::size_t ip = 0; ip < limit;)
+                    {
+                        auto sequence = read32(src + ip);
+                        auto& entry = table_[(sequence * 2654435761u) >> (32 - hash_log)];
+                        std::size_t ref = entry;
+                        entry = static_cast<std::uint32_t>(ip);
+
+                        if (ref < ip && ip - ref <= 65535 && read32(src + ref) == sequence)
+                        {
+                            auto length = min_match;
+                            while (ip + length < match_limit &&
+                                   src[ref + length] == src[ip + length])
+                            {
+                                ++length;
+                            }
+
+                            op = write_sequence(op, src + anchor, ip - anchor);
+
+                            *op++ = static_cast<unsigned char>(ip - ref);
+                            *op++ = static_cast<unsigned char>((ip - ref) >> 8);
+
+                            op = write_match_length(op, length - min_match);
+
+                            ip += length;
+                            anchor = ip;
+                        }
+                        else
+                        {
+                            // skip faster through incompressible data
+                            ip += 1 + ((ip - anchor) >> 6);
+                        }
+                    }
+                }
+
+                op = write_sequence(op, src + anchor, size - anchor);
+
+                return op - reinterpret_cast<unsigned char*>(dest);
+            }
+
+            // returns false, if the data is corrupt or does not decompress to exactly dest_size
+            static bool decompress(const char* source, std::size_t size, char* dest,
+                                   std::size_t dest_size)
+            {
+                auto ip = reinterpret_cast<const unsigned char*>(source);
+                auto iend = ip + size;
+                auto op = reinterpret_cast<unsigned char*>(dest);
+                auto ostart = op;
+                auto oend = op + dest_size;
+
+                while (ip < iend)
+                {
+                    unsigned token = *ip++;
+
+                    std::size_t literals = token >> 4;
+                    if (literals == 15 && !read_length(ip, iend, literals))
+                    {
+                        return false;
+                    }
+
+                    if (literals > static_cast<std::size_t>(iend - ip) ||
+                        literals > static_cast<std::size_t>(oend - op))
+                    {
+                        return false;
+                    }
+
+                    std::memcpy(op, ip, literals);
+                    ip += literals;
+                    op += literals;
+
+                    // the last sequence has no match
+                    if (ip == iend)
+                    {
+                        return op == oend;
+                    }
+
+                    if (iend - ip < 2)
+                    {
+                        return false;
+                    }
+
+                    std::size_t offset = ip[0] | (ip[1] << 8);
+                    ip += 2;
+
+                    if (offset == 0 || offset > static_cast<std::size_t>(op - ostart))
+                    {
+                        return false;
+                    }
+
+                    std::size_t length = token & 15;
+                    if (length == 15 && !read_length(ip, iend, length))
+                    {
+                        return false;
+                    }
+                    length += min_match;
+
+                    if (length > static_cast<std::size_t>(oend - op))
+                    {
+                        return false;
+                    }
+
+                    auto match = op - offset;
+                    if (offset >= length)
+                    {
+                        std::memcpy(op, match, length);
+                        op += length;
+                    }
+                    else
+                    {
+                        // overlapping copy repeats the last offset bytes
+                        for (auto end = op + length; op != end;)
+                        {
+                            *op++ = *match++;
+                        }
+                    }
+                }
+
+                return false;
+            }
+
+        private:
+            static std::uint32_t read32(const unsigned char* ptr)
+            {
+                std::uint32_t value;
+                std::memcpy(&value, ptr, sizeof(value));
+                return value;
+            }
+
+            static unsigned char* write_length(unsigned char* op, std::size_t length)
+            {
+                for (; length >= 255; length -= 255)
+                {
+                    *op++ = 255;
+                }
+
+                *op++ = static_cast<unsigned char>(length);
+                return op;
+            }
+
+            // writes the token and the literals, the match length is added to the token later
+            unsigned char* write_sequence(unsigned char* op, const unsigned char* literals,
+                                          std::size_t size)
+            {
+                token_ = op++;
+                *token_ = static_cast<unsigned char>(std::min<std::size_t>(size, 15) << 4);
+
+                if (size >= 15)
+                {
+                    op = write_length(op, size - 15);
+                }
+
+                std::memcpy(op, literals, size);
+                return op + size;
+            }
+
+            unsigned char* write_match_length(unsigned char* op, std::size_t length)
+            {
+                *token_ |= static_cast<unsigned char>(std::min<std::size_t>(length, 15));
+
+                if (length >= 15)
+                {
+                    op = write_length(op, length - 15);
+                }
+
+                return op;
+            }
+
+            static bool read_length(const unsigned char*& ip, const unsigned char* iend,
+                                    std::size_t& length)
+            {
+                unsigned char byte;
+
+                do
+                {
+                    if (ip == iend)
+                    {
+                        return false;
+                    }
+
+                    byte = *ip++;
+                    length += byte;
+                } while (byte == 255);
+
+                return true;
+            }
+
+        private:
+            std::vector<std::uint32_t> table_ = std::vector<std::uint32_t>(1u << hash_log);
+            unsigned char* token_ = nullptr;
+        };
+    } // namespace detail
+} // namespace log
+} // namespace nitro
+
+#endif // INCLUDE_NITRO_LOG_DETAIL_LZ4_BLOCK_HPP
@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2026, Technische Universität Dresden, Germany
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted
+ * provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+ *    and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to
+ *    endorse or promote products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ * WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef INCLUDE_NITRO_LOG_DETAIL_MAPPED_FILE_HPP
+#define INCLUDE_NITRO_LOG_DETAIL_MAPPED_FILE_HPP
+
+#include <nitro/except/raise.hpp>
+
+#include <cstring>
+#include <string>
+
+#include <cerrno>
+
+extern "C"
+{
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+}
+
+namespace nitro
+{
+namespace log
+{
+    namespace detail
+    {
+        /**
+         * @brief Read-only memory mapping of a whole file.
+         */
+        class mapped_file
+        {
+        public:
+            explicit mapped_file(const std::string& file_name)
+            {
+                int fd = ::open(file_name.c_str(), O_RDONLY);
+                if (fd == -1)
+                {
+                    raise("Cannot open file: ", file_name, ": ", std::strerror(errno));
+                }
+
+                struct stat st;
+                if (::fstat(fd, &st) != 0)
+                {
+                    ::close(fd);
+                    raise("Cannot stat file: ", file_name);
+                }
+
+                size_ = static_cast<std::size_t>(st.st_size);
+
+                if (size_ > 0)
+                {
+                    auto addr = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+
+                    if (addr == MAP_FAILED)
+                    {
+                        ::close(fd);
+                        raise("Cannot map file: ", file_name);
+                    }
+
+                    data_ = static_cast<const char*>(addr);
+                }
+
+                ::close(fd);
+            }
+
+            mapped_file(const mapped_file&) = delete;
+            mapped_file& operator=(const mapped_file&) = delete;
+
+            ~mapped_file()
+            {
+                if (data_ != nullptr)
+                {
+                    ::munmap(const_cast<char*>(data_), size_);
+                }
+            }
+
+            // hints the kernel to read ahead for a sequential scan of the range
+            void will_need(std::size_t offset, std::size_t size) const
+            {
+                auto page = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+                auto begin = offset / page * page;
+
+                ::madvise(const_cast<char*>(data_) + begin, offset + size - begin, MADV_WILLNEED);
+            }
+
+            // hints the kernel to read ahead aggressively and drop pages behind a linear scan
+            void sequential() const
+            {
+                if (data_ != nullptr)
+                {
+                    ::madvise(const_cast<char*>(data_), size_, MADV_SEQUENTIAL);
+                }
+            }
+
+            const char* data() const
+            {
+                return data_;
+            }
+
+            std::size_t size() const
+            {
+                return size_;
+            }
+
+        private:
+            const char* data_ = nullptr;
+            std::size_t size_ = 0;
+        };
+    } // namespace detail
+} // namespace log
+} // namespace nitro
+
+#endif // INCLUDE_NITRO_LOG_DETAIL_MAPPED_FILE_HPP
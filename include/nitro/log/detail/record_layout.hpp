@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2026, Technische Universität Dresden, Germany
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted
+ * provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+ *    and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to
+ *    endorse or promote products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ * WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef INCLUDE_NITRO_LOG_DETAIL_RECORD_LAYOUT_HPP
+#define INCLUDE_NITRO_LOG_DETAIL_RECORD_LAYOUT_HPP
+
+#include <cstddef>
+#include <type_traits>
+
+namespace nitro
+{
+namespace log
+{
+    namespace detail
+    {
+
+        template <typename... Types>
+        struct type_list
+        {
+        };
+
+        // stricter alignment first, then larger size, empty attributes last
+        template <typename A, typename B>
+        struct layout_before
+        {
+            static const bool value =
+                !std::is_empty<A>::value &&
+                (std::is_empty<B>::value || alignof(A) > alignof(B) ||
+                 (alignof(A) == alignof(B) && sizeof(A) > sizeof(B)));
+        };
+
+        template <typename T, typename List>
+        struct layout_prepend;
+
+        template <typename T, typename... Types>
+        struct layout_prepend<T, type_list<Types...>>
+        {
+            using type = type_list<T, Types...>;
+        };
+
+        // inserts T behind all elements that are not after it, so equal attributes keep their
+        // declared order
+        template <typename T, typename List>
+        struct layout_insert;
+
+        template <typename T>
+        struct layout_insert<T, type_list<>>
+        {
+            using type = type_list<T>;
+        };
+
+        template <typename T, typename Head, typename... Tail>
+        struct layout_insert<T, type_list<Head, Tail...>>
+        {
+            using type = typename std::conditional<
+                layout_before<T, Head>::value, type_list<T, Head, Tail...>,
+                typename layout_prepend<
+                    Head, typename layout_insert<T, type_list<Tail...>>::type>::type>::type;
+        };
+
+        template <typename List, typename... Attributes>
+        struct layout_sort
+        {
+            using type = List;
+        };
+
+        template <typename List, typename Attribute, typename... Attributes>
+        struct layout_sort<List, Attribute, Attributes...>
+        {
+            using type = typename layout_sort<typename layout_insert<Attribute, List>::type,
+                                              Attributes...>::type;
+        };
+
+        template <typename... Attributes>
+        using sorted_attributes = typename layout_sort<type_list<>, Attributes...>::type;
+
+        template <typename List>
+        class record_storage;
+
+        template <typename... Attributes>
+        class record_storage<type_list<Attributes...>> : public Attributes...
+        {
+        };
+
+        template <typename... Attributes>
+        struct attributes_size;
+
+        template <>
+        struct attributes_size<>
+        {
+            static constexpr std::size_t value()
+            {
+                return 0;
+            }
+        };
+
+        template <typename Attribute, typename... Attributes>
+        struct attributes_size<Attribute, Attributes...>
+        {
+            static constexpr std::size_t value()
+            {
+                return (std::is_empty<Attribute>::value ? 0 : sizeof(Attribute)) +
+                       attributes_size<Attributes...>::value();
+            }
+        };
+    } // namespace detail
+} // namespace log
+} // namespace nitro
+
+#endif // INCLUDE_NITRO_LOG_DETAIL_RECORD_LAYOUT_HPP
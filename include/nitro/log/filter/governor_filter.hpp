@@ -0,0 +1,462 @@
+/*
+ * Copyright (c) 2026, Technische Universität Dresden, Germany
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted
+ * provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+ *    and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to
+ *    endorse or promote products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ * WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef INCLUDE_NITRO_LOG_FILTER_GOVERNOR_FILTER_HPP
+#define INCLUDE_NITRO_LOG_FILTER_GOVERNOR_FILTER_HPP
+
+#include <nitro/log/severity.hpp>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+
+namespace nitro
+{
+namespace log
+{
+    namespace filter
+    {
+
+        /**
+         * @brief Describes a change of the minimum severity made by a governor_filter.
+         *
+         * The rates are the volume of the window that caused the change, measured at the
+         * previous minimum severity.
+         */
+        struct governor_transition
+        {
+            severity_level from;
+            severity_level to;
+            double records_per_second;
+            double bytes_per_second;
+        };
+
+        template <typename S>
+        S& operator<<(S& s, const governor_transition& t)
+        {
+            s << "nitro::log governor: minimum severity " << (t.to > t.from ? "raised" : "lowered")
+              << " from " << t.from << " to " << t.to << " ("
+              << static_cast<std::uint64_t>(t.records_per_second) << " records/s, "
+              << static_cast<std::uint64_t>(t.bytes_per_second) << " bytes/s)";
+            return s;
+        }
+
+        /**
+         * @brief Keeps the log volume within a budget by adapting the minimum severity.
+         *
+         * The filter counts the records of every severity in windows of interval(). At the end
+         * of a window, it picks the lowest minimum severity between base_severity() and
+         * max_severity() whose volume stays within records_budget() and bytes_budget(). The
+         * minimum severity is raised at once, but only lowered by one level per window and only
+         * if the volume at that level fits into lower_ratio() of the budgets. Records with at
+         * least max_severity() always pass. Each change is passed to reporter(), which is empty
+         * by default, e.g. to log it through another logger.
+         *
+         * Records below the current minimum severity are counted per thread and added to the
+         * shared counters in batches of 16, so dropping them neither reads the clock nor writes
+         * a shared cache line every time. The rates may therefore miss up to 16 records per
+         * thread.
+         *
+         * The filter sees records before they are formatted. The bytes budget therefore needs
+         * the formatted sizes from a sink::governed wrapper around the sink. For records that
+         * were filtered, the average size of the emitted records is used.
+         *
+         * A budget of zero disables it. The configuration is shared by all instances with the
+         * same template arguments and should be set before logging starts.
+         */
+        template <typename Record, unsigned N = 0, typename Clock = std::chrono::steady_clock>
+        class governor_filter
+        {
+            static constexpr std::size_t levels = 6;
+            static constexpr std::uint32_t dropped_batch_size = 16;
+
+            struct state_type
+            {
+                std::atomic<severity_level> level{ severity_level::trace };
+                std::atomic<std::int64_t> window_end{ 0 };
+                std::int64_t window_begin = 0;
+                bool started = false;
+
+                std::array<std::atomic<std::uint64_t>, levels> records{};
+                std::array<std::atomic<std::uint64_t>, levels> emitted{};
+                std::array<std::atomic<std::uint64_t>, levels> bytes{};
+
+                std::uint64_t average_size = 0;
+                std::atomic<std::uint64_t> transitions{ 0 };
+
+                std::mutex mutex;
+            };
+
+            // records of the calling thread, which were dropped, but not yet counted in state()
+            struct dropped_batch
+            {
+                std::array<std::uint32_t, levels> records{};
+                std::uint32_t size = 0;
+            };
+
+        public:
+            typedef Record record_type;
+
+            static double& records_budget()
+            {
+                static double budget = 0;
+                return budget;
+            }
+
+            static double& bytes_budget()
+            {
+                static double budget = 0;
+                return budget;
+            }
+
+            static std::chrono::milliseconds& interval()
+            {
+                static std::chrono::milliseconds interval(1000);
+                return interval;
+            }
+
+            static severity_level& base_severity()
+            {
+                static severity_level sev = severity_level::trace;
+                return sev;
+            }
+
+            static severity_level& max_severity()
+            {
+                static severity_level sev = severity_level::warn;
+                return sev;
+            }
+
+            static double& lower_ratio()
+            {
+                static double ratio = 0.5;
+                return ratio;
+            }
+
+            static std::function<void(const governor_transition&)>& reporter()
+            {
+                static std::function<void(const governor_transition&)> reporter;
+                return reporter;
+            }
+
+            static severity_level min_severity()
+            {
+                auto& s = state();
+
+                // before the first record, base_severity() may still change
+                if (s.window_end.load(std::memory_order_relaxed) == 0)
+                {
+                    return base_severity();
+                }
+
+                return s.level.load(std::memory_order_relaxed);
+            }
+
+            static std::uint64_t transitions()
+            {
+                return state().transitions.load(std::memory_order_relaxed);
+            }
+
+            // drops the counters and returns to base_severity()
+            static void reset()
+            {
+                auto& s = state();
+                std::lock_guard<std::mutex> lock(s.mutex);
+
+                for (std::size_t i = 0; i < levels; ++i)
+                {
+                    s.records[i].store(0, std::memory_order_relaxed);
+                    s.emitted[i].store(0, std::memory_order_relaxed);
+                    s.bytes[i].store(0, std::memory_order_relaxed);
+                }
+
+                s.level.store(base_severity(), std::memory_order_relaxed);
+                s.window_end.store(0, std::memory_order_relaxed);
+                s.window_begin = 0;
+                s.started = false;
+                s.average_size = 0;
+                s.transitions.store(0, std::memory_order_relaxed);
+            }
+
+            // called by sink::governed with the size of each formatted record
+            static void account(severity_level sev, std::size_t size)
+            {
+                auto& s = state();
+                auto i = index(sev);
+
+                s.emitted[i].fetch_add(1, std::memory_order_relaxed);
+                s.bytes[i].fetch_add(size, std::memory_order_relaxed);
+            }
+
+            bool filter(Record& r) const
+            {
+                auto& s = state();
+                auto sev = r.severity();
+
+                if (sev < s.level.load(std::memory_order_relaxed))
+                {
+                    auto& batch = local_dropped();
+                    ++batch.records[index(sev)];
+
+                    if (++batch.size >= dropped_batch_size)
+                    {
+                        // also closes the window, if only dropped records arrive
+                        update(s, batch);
+                    }
+
+                    return false;
+                }
+
+                update(s, local_dropped());
+
+                s.records[index(sev)].fetch_add(1, std::memory_order_relaxed);
+
+                return sev >= s.level.load(std::memory_order_relaxed);
+            }
+
+        private:
+            static state_type& state()
+            {
+                static state_type state_;
+                return state_;
+            }
+
+            static std::size_t index(severity_level sev)
+            {
+                return static_cast<std::size_t>(sev);
+            }
+
+            static dropped_batch& local_dropped()
+            {
+                static thread_local dropped_batch batch;
+                return batch;
+            }
+
+            // adds the dropped records of the calling thread and closes the window if it is over
+            static void update(state_type& s, dropped_batch& batch)
+            {
+                if (batch.size > 0)
+                {
+                    for (std::size_t i = 0; i < levels; ++i)
+                    {
+                        if (batch.records[i] > 0)
+                        {
+                            s.records[i].fetch_add(batch.records[i], std::memory_order_relaxed);
+                            batch.records[i] = 0;
+                        }
+                    }
+
+                    batch.size = 0;
+                }
+
+                auto now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                               Clock::now().time_since_epoch())
+                               .count();
+
+                if (now >= s.window_end.load(std::memory_order_relaxed))
+                {
+                    roll(now);
+                }
+            }
+
+            static void roll(std::int64_t now)
+            {
+                auto& s = state();
+                governor_transition transition;
+                std::function<void(const governor_transition&)> report;
+
+                {
+                    // whoever gets the lock closes the window, everybody else just goes on.
+                    // Only the first window is waited for, as it sets the level to begin with.
+                    std::unique_lock<std::mutex> lock(s.mutex, std::defer_lock);
+
+                    if (s.window_end.load(std::memory_order_relaxed) == 0)
+                    {
+                        lock.lock();
+                    }
+                    else if (!lock.try_lock())
+                    {
+                        return;
+                    }
+
+                    if (now < s.window_end.load(std::memory_order_relaxed))
+                    {
+                        return;
+                    }
+
+                    auto begin = s.window_begin;
+                    auto started = s.started;
+
+                    s.window_begin = now;
+                    s.started = true;
+                    s.window_end.store(
+                        now + std::chrono::duration_cast<std::chrono::nanoseconds>(interval())
+                                  .count(),
+                        std::memory_order_relaxed);
+
+                    if (!started)
+                    {
+                        s.level.store(base_severity(), std::memory_order_relaxed);
+                    }
+
+                    if (!started || now <= begin)
+                    {
+                        clear_counters(s);
+                        return;
+                    }
+
+                    transition.from = s.level.load(std::memory_order_relaxed);
+                    transition.to = next_level(s, transition.from, 1e-9 * (now - begin),
+                                               transition.records_per_second,
+                                               transition.bytes_per_second);
+
+                    if (transition.to == transition.from)
+                    {
+                        return;
+                    }
+
+                    s.level.store(transition.to, std::memory_order_relaxed);
+                    s.transitions.fetch_add(1, std::memory_order_relaxed);
+
+                    report = reporter();
+                }
+
+                // outside of the lock, so the reporter may log through this filter
+                if (report)
+                {
+                    report(transition);
+                }
+            }
+
+            // requires s.mutex to be locked
+            static void clear_counters(state_type& s)
+            {
+                for (std::size_t i = 0; i < levels; ++i)
+                {
+                    s.records[i].store(0, std::memory_order_relaxed);
+                    s.emitted[i].store(0, std::memory_order_relaxed);
+                    s.bytes[i].store(0, std::memory_order_relaxed);
+                }
+            }
+
+            // requires s.mutex to be locked
+            static severity_level next_level(state_type& s, severity_level current,
+                                             double seconds, double& current_records,
+                                             double& current_bytes)
+            {
+                std::array<double, levels> records;
+                std::array<double, levels> emitted;
+                std::array<double, levels> bytes;
+
+                double emitted_records = 0;
+                double emitted_bytes = 0;
+
+                for (std::size_t i = 0; i < levels; ++i)
+                {
+                    records[i] = s.records[i].exchange(0, std::memory_order_relaxed);
+                    emitted[i] = s.emitted[i].exchange(0, std::memory_order_relaxed);
+                    bytes[i] = s.bytes[i].exchange(0, std::memory_order_relaxed);
+
+                    emitted_records += emitted[i];
+                    emitted_bytes += bytes[i];
+                }
+
+                if (emitted_records > 0)
+                {
+                    s.average_size = static_cast<std::uint64_t>(emitted_bytes / emitted_records);
+                }
+
+                // volume per second of all records with at least the given severity
+                auto rates = [&](std::size_t level, double& records_rate, double& bytes_rate) {
+                    records_rate = 0;
+                    bytes_rate = 0;
+
+                    for (std::size_t i = level; i < levels; ++i)
+                    {
+                        auto missing = records[i] > emitted[i] ? records[i] - emitted[i] : 0;
+
+                        records_rate += records[i];
+                        bytes_rate += bytes[i] + missing * s.average_size;
+                    }
+
+                    records_rate /= seconds;
+                    bytes_rate /= seconds;
+                };
+
+                auto fits = [&](std::size_t level, double ratio) {
+                    double records_rate, bytes_rate;
+                    rates(level, records_rate, bytes_rate);
+
+                    return (records_budget() <= 0 || records_rate <= ratio * records_budget()) &&
+                           (bytes_budget() <= 0 || bytes_rate <= ratio * bytes_budget());
+                };
+
+                auto base = index(base_severity());
+                auto ceiling = index(max_severity());
+
+                if (ceiling < base)
+                {
+                    ceiling = base;
+                }
+
+                auto level = index(current);
+
+                rates(level, current_records, current_bytes);
+
+                auto target = ceiling;
+                for (auto i = base; i < ceiling; ++i)
+                {
+                    if (fits(i, 1.0))
+                    {
+                        target = i;
+                        break;
+                    }
+                }
+
+                if (target > level)
+                {
+                    return static_cast<severity_level>(target);
+                }
+
+                if (level > base && (level > ceiling || fits(level - 1, lower_ratio())))
+                {
+                    return static_cast<severity_level>(level - 1);
+                }
+
+                return current;
+            }
+        };
+    } // namespace filter
+} // namespace log
+} // namespace nitro
+
+#endif // INCLUDE_NITRO_LOG_FILTER_GOVERNOR_FILTER_HPP
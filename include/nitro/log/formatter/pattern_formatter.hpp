@@ -0,0 +1,346 @@
+/*
+ * Copyright (c) 2026, Technische Universität Dresden, Germany
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted
+ * provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+ *    and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to
+ *    endorse or promote products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ * WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef INCLUDE_NITRO_LOG_FORMATTER_PATTERN_FORMATTER_HPP
+#define INCLUDE_NITRO_LOG_FORMATTER_PATTERN_FORMATTER_HPP
+
+#include <nitro/log/attribute/message.hpp>
+#include <nitro/log/detail/has_attribute.hpp>
+#include <nitro/log/message_stream.hpp>
+
+#include <cstddef>
+#include <string>
+
+namespace nitro
+{
+namespace log
+{
+    class tag_attribute;
+    class severity_attribute;
+    class pid_attribute;
+    class hostname_attribute;
+    class rank_attribute;
+    class mpi_rank_attribute;
+    class omp_thread_id_attribute;
+    class std_thread_id_attribute;
+    class stacktrace_attribute;
+
+    template <typename Clock>
+    class timestamp_clock_attribute;
+
+    namespace detail
+    {
+        constexpr std::size_t pattern_length(const char* pattern, std::size_t pos = 0)
+        {
+            return pattern[pos] == '\0' ? pos : pattern_length(pattern, pos + 1);
+        }
+
+        constexpr std::size_t pattern_literal_end(const char* pattern, std::size_t pos)
+        {
+            return pattern[pos] == '\0' || pattern[pos] == '%' ?
+                       pos :
+                       pattern_literal_end(pattern, pos + 1);
+        }
+
+        template <bool Enabled>
+        struct pattern_emit_if
+        {
+            template <typename Function, typename Record>
+            static void call(Function f, Record& r)
+            {
+                f(r);
+            }
+        };
+
+        template <>
+        struct pattern_emit_if<false>
+        {
+            template <typename Function, typename Record>
+            static void call(Function, Record&)
+            {
+            }
+        };
+
+        template <typename Attribute, typename Record, typename Function>
+        void pattern_emit(Record& r, Function f)
+        {
+            pattern_emit_if<has_attribute<Attribute, Record>::value>::call(f, r);
+        }
+
+        template <char Placeholder>
+        struct pattern_placeholder
+        {
+            static_assert(Placeholder == '%', "Unknown placeholder in log pattern");
+
+            template <typename Record, typename Stream>
+            static void emit(Record&, Stream& s)
+            {
+                s << '%';
+            }
+        };
+
+        template <>
+        struct pattern_placeholder<'m'>
+        {
+            template <typename Record, typename Stream>
+            static void emit(Record& r, Stream& s)
+            {
+                s << r.message();
+            }
+        };
+
+        template <>
+        struct pattern_placeholder<'s'>
+        {
+            template <typename Record, typename Stream>
+            static void emit(Record& r, Stream& s)
+            {
+                static_assert(has_attribute<severity_attribute, Record>::value,
+                              "Log pattern uses %s, but the record has no severity_attribute");
+
+                pattern_emit<severity_attribute>(r, [&s](auto& record) { s << record.severity(); });
+            }
+        };
+
+        template <>
+        struct pattern_placeholder<'t'>
+        {
+            template <typename Record, typename Stream>
+            static void emit(Record& r, Stream& s)
+            {
+                static_assert(has_attribute<tag_attribute, Record>::value,
+                              "Log pattern uses %t, but the record has no tag_attribute");
+
+                pattern_emit<tag_attribute>(r, [&s](auto& record) { s << record.tag(); });
+            }
+        };
+
+        template <>
+        struct pattern_placeholder<'d'>
+        {
+            template <typename Record, typename Stream>
+            static void emit(Record& r, Stream& s)
+            {
+                constexpr bool has_timestamp =
+                    has_attribute_specialization<timestamp_clock_attribute, Record>::value;
+
+                static_assert(has_timestamp,
+                              "Log pattern uses %d, but the record has no timestamp attribute");
+
+                pattern_emit_if<has_timestamp>::call(
+                    [&s](auto& record) { s << record.timestamp().time_since_epoch().count(); },
+                    r);
+            }
+        };
+
+        template <>
+        struct pattern_placeholder<'p'>
+        {
+            template <typename Record, typename Stream>
+            static void emit(Record& r, Stream& s)
+            {
+                static_assert(has_attribute<pid_attribute, Record>::value,
+                              "Log pattern uses %p, but the record has no pid_attribute");
+
+                pattern_emit<pid_attribute>(r, [&s](auto& record) { s << record.pid(); });
+            }
+        };
+
+        template <>
+        struct pattern_placeholder<'i'>
+        {
+            template <typename Record, typename Stream>
+            static void emit(Record& r, Stream& s)
+            {
+                static_assert(has_attribute<pid_attribute, Record>::value,
+                              "Log pattern uses %i, but the record has no pid_attribute");
+
+                pattern_emit<pid_attribute>(r, [&s](auto& record) { s << record.tid(); });
+            }
+        };
+
+        template <>
+        struct pattern_placeholder<'T'>
+        {
+            template <typename Record, typename Stream>
+            static void emit(Record& r, Stream& s)
+            {
+                static_assert(has_attribute<std_thread_id_attribute, Record>::value,
+                              "Log pattern uses %T, but the record has no std_thread_id_attribute");
+
+                pattern_emit<std_thread_id_attribute>(
+                    r, [&s](auto& record) { s << record.std_thread_id(); });
+            }
+        };
+
+        template <>
+        struct pattern_placeholder<'h'>
+        {
+            template <typename Record, typename Stream>
+            static void emit(Record& r, Stream& s)
+            {
+                static_assert(has_attribute<hostname_attribute, Record>::value,
+                              "Log pattern uses %h, but the record has no hostname_attribute");
+
+                pattern_emit<hostname_attribute>(r, [&s](auto& record) { s << record.hostname(); });
+            }
+        };
+
+        template <>
+        struct pattern_placeholder<'r'>
+        {
+            template <typename Record, typename Stream>
+            static void emit(Record& r, Stream& s)
+            {
+                static_assert(has_attribute<rank_attribute, Record>::value,
+                              "Log pattern uses %r, but the record has no rank_attribute");
+
+                pattern_emit<rank_attribute>(r, [&s](auto& record) { s << record.rank(); });
+            }
+        };
+
+        template <>
+        struct pattern_placeholder<'R'>
+        {
+            template <typename Record, typename Stream>
+            static void emit(Record& r, Stream& s)
+            {
+                static_assert(has_attribute<mpi_rank_attribute, Record>::value,
+                              "Log pattern uses %R, but the record has no mpi_rank_attribute");
+
+                pattern_emit<mpi_rank_attribute>(r, [&s](auto& record) { s << record.mpi_rank(); });
+            }
+        };
+
+        template <>
+        struct pattern_placeholder<'o'>
+        {
+            template <typename Record, typename Stream>
+            static void emit(Record& r, Stream& s)
+            {
+                static_assert(has_attribute<omp_thread_id_attribute, Record>::value,
+                              "Log pattern uses %o, but the record has no omp_thread_id_attribute");
+
+                pattern_emit<omp_thread_id_attribute>(
+                    r, [&s](auto& record) { s << record.omp_thread_id(); });
+            }
+        };
+
+        template <>
+        struct pattern_placeholder<'S'>
+        {
+            template <typename Record, typename Stream>
+            static void emit(Record& r, Stream& s)
+            {
+                static_assert(has_attribute<stacktrace_attribute, Record>::value,
+                              "Log pattern uses %S, but the record has no stacktrace_attribute");
+
+                pattern_emit<stacktrace_attribute>(
+                    r, [&s](auto& record) { record.stacktrace().write(s); });
+            }
+        };
+
+        // literal text up to the next placeholder
+        template <const char* Pattern, std::size_t Pos, char Current = Pattern[Pos]>
+        struct pattern_steps
+        {
+            static constexpr std::size_t end = pattern_literal_end(Pattern, Pos);
+
+            template <typename Record, typename Stream>
+            static void emit(Record& r, Stream& s)
+            {
+                s.write(Pattern + Pos, end - Pos);
+                pattern_steps<Pattern, end>::emit(r, s);
+            }
+        };
+
+        template <const char* Pattern, std::size_t Pos>
+        struct pattern_steps<Pattern, Pos, '%'>
+        {
+            static_assert(Pattern[Pos + 1] != '\0', "Log pattern must not end with a single %");
+
+            static constexpr std::size_t next = Pattern[Pos + 1] == '\0' ? Pos + 1 : Pos + 2;
+
+            template <typename Record, typename Stream>
+            static void emit(Record& r, Stream& s)
+            {
+                pattern_placeholder<Pattern[Pos + 1]>::emit(r, s);
+                pattern_steps<Pattern, next>::emit(r, s);
+            }
+        };
+
+        template <const char* Pattern, std::size_t Pos>
+        struct pattern_steps<Pattern, Pos, '\0'>
+        {
+            template <typename Record, typename Stream>
+            static void emit(Record&, Stream&)
+            {
+            }
+        };
+    } // namespace detail
+
+    namespace formatter
+    {
+        /**
+         * @brief Formatter for a pattern, which is compiled into a sequence of steps at compile
+         * time.
+         *
+         * The pattern has to be a constexpr char array with linkage, e.g.
+         *
+         *     constexpr char pattern[] = "[%d][%s][%t]: %m\n";
+         *
+         *     template <typename Record>
+         *     using formatter = nitro::log::formatter::pattern_formatter<Record, pattern>;
+         *
+         * Supported placeholders are %m (message), %s (severity), %t (tag), %d (timestamp since
+         * the epoch of its clock), %p (pid), %i (tid), %T (std::thread::id), %h (hostname),
+         * %r (rank), %R (MPI rank), %o (OpenMP thread id), %S (captured stack trace, one line per
+         * frame) and %% (a single %). Using a placeholder for an attribute, which is missing in
+         * the record, is a compile-time error.
+         */
+        template <typename Record, const char* Pattern>
+        class pattern_formatter
+        {
+        public:
+            std::string format(Record& r)
+            {
+                std::string result;
+                result.reserve(detail::pattern_length(Pattern) + r.message().size() + 32);
+
+                basic_message_stream<std::string> s(result);
+                detail::pattern_steps<Pattern, 0>::emit(r, s);
+                s.flush();
+
+                return result;
+            }
+        };
+    } // namespace formatter
+} // namespace log
+} // namespace nitro
+
+#endif // INCLUDE_NITRO_LOG_FORMATTER_PATTERN_FORMATTER_HPP
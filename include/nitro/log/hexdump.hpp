@@ -0,0 +1,246 @@
+/*
+ * Copyright (c) 2026, Technische Universität Dresden, Germany
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted
+ * provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+ *    and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to
+ *    endorse or promote products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ * WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef INCLUDE_NITRO_LOG_HEXDUMP_HPP
+#define INCLUDE_NITRO_LOG_HEXDUMP_HPP
+
+#include <nitro/log/message_stream.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace nitro
+{
+namespace log
+{
+    namespace detail
+    {
+        // writes 2 * size lower case hex digits to dest
+        inline void hex_encode(const unsigned char* src, std::size_t size, char* dest)
+        {
+#if defined(__SSE2__)
+            const __m128i mask = _mm_set1_epi8(0x0f);
+            const __m128i nine = _mm_set1_epi8(9);
+            const __m128i zero = _mm_set1_epi8('0');
+            // distance from '9' + 1 to 'a'
+            const __m128i letters = _mm_set1_epi8('a' - '0' - 10);
+
+            auto to_digits = [&](__m128i nibbles) {
+                auto offset = _mm_and_si128(_mm_cmpgt_epi8(nibbles, nine), letters);
+                return _mm_add_epi8(_mm_add_epi8(nibbles, zero), offset);
+            };
+
+            for (; size >= 16; size -= 16, src += 16, dest += 32)
+            {
+                auto in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+
+                auto high = to_digits(_mm_and_si128(_mm_srli_epi16(in, 4), mask));
+                auto low = to_digits(_mm_and_si128(in, mask));
+
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dest), _mm_unpacklo_epi8(high, low));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dest + 16),
+                                 _mm_unpackhi_epi8(high, low));
+            }
+#endif
+
+            static const char digits[] = "0123456789abcdef";
+
+            for (; size > 0; --size, ++src)
+            {
+                *dest++ = digits[*src >> 4];
+                *dest++ = digits[*src & 0x0f];
+            }
+        }
+    } // namespace detail
+
+    /**
+     * @brief Argument for log streams writing the bytes of a buffer as hex digits.
+     *
+     * The bytes are only encoded if the record gets logged, so the buffer has to stay valid
+     * until the end of the log statement. At most max bytes are written, followed by the total
+     * size of the buffer if it was truncated.
+     */
+    class hexdump_argument
+    {
+        static constexpr std::size_t line_bytes = 16;
+        // newline, offset, space, hex bytes with an extra space in the middle, space and bars
+        static constexpr std::size_t line_overhead = 1 + 8 + 2 + 3 * line_bytes + 1 + 2 + 1;
+
+    public:
+        hexdump_argument(const void* data, std::size_t size, std::size_t max)
+        : data_(static_cast<const unsigned char*>(data)), size_(size), max_(max)
+        {
+        }
+
+        /**
+         * @brief Returns the dump as lines of 16 bytes with offsets and an ASCII column, e.g.
+         * "\n00000000  68 65 6c 6c 6f                                    |hello|".
+         */
+        hexdump_argument ascii() const
+        {
+            auto result = *this;
+            result.ascii_ = true;
+            return result;
+        }
+
+        template <typename Stream>
+        void write(Stream& s) const
+        {
+            if (data_ == nullptr)
+            {
+                s << "(null)";
+                return;
+            }
+
+            s.write_direct(encoded_size(), [this](char* dest) { encode(dest); });
+
+            if (size_ > max_)
+            {
+                s << (ascii_ ? "\n" : "") << "... (" << std::to_string(size_) << " bytes)";
+            }
+        }
+
+        void write(std::ostream& s) const
+        {
+            std::string buffer;
+            basic_message_stream<std::string> stream(buffer);
+
+            write(stream);
+            s.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        }
+
+    private:
+        std::size_t bytes() const
+        {
+            return size_ < max_ ? size_ : max_;
+        }
+
+        std::size_t encoded_size() const
+        {
+            if (!ascii_)
+            {
+                return 2 * bytes();
+            }
+
+            auto lines = (bytes() + line_bytes - 1) / line_bytes;
+            return lines * line_overhead + bytes();
+        }
+
+        void encode(char* dest) const
+        {
+            if (!ascii_)
+            {
+                detail::hex_encode(data_, bytes(), dest);
+                return;
+            }
+
+            char hex[2 * line_bytes];
+
+            for (std::size_t offset = 0; offset < bytes(); offset += line_bytes)
+            {
+                auto count = bytes() - offset < line_bytes ? bytes() - offset : line_bytes;
+
+                // big endian, so the hex digits read as the offset
+                unsigned char offset_bytes[4] = { static_cast<unsigned char>(offset >> 24),
+                                                  static_cast<unsigned char>(offset >> 16),
+                                                  static_cast<unsigned char>(offset >> 8),
+                                                  static_cast<unsigned char>(offset) };
+
+                *dest++ = '\n';
+                detail::hex_encode(offset_bytes, 4, dest);
+                dest += 8;
+                *dest++ = ' ';
+
+                detail::hex_encode(data_ + offset, count, hex);
+
+                for (std::size_t i = 0; i < line_bytes; ++i)
+                {
+                    *dest++ = ' ';
+                    if (i == line_bytes / 2)
+                    {
+                        *dest++ = ' ';
+                    }
+
+                    *dest++ = i < count ? hex[2 * i] : ' ';
+                    *dest++ = i < count ? hex[2 * i + 1] : ' ';
+                }
+
+                *dest++ = ' ';
+                *dest++ = ' ';
+                *dest++ = '|';
+
+                for (std::size_t i = 0; i < count; ++i)
+                {
+                    auto c = data_[offset + i];
+                    *dest++ = c >= 0x20 && c < 0x7f ? static_cast<char>(c) : '.';
+                }
+
+                *dest++ = '|';
+            }
+        }
+
+    private:
+        const unsigned char* data_;
+        std::size_t size_;
+        std::size_t max_;
+        bool ascii_ = false;
+    };
+
+    inline std::ostream& operator<<(std::ostream& s, const hexdump_argument& arg)
+    {
+        arg.write(s);
+        return s;
+    }
+
+    template <typename String>
+    inline basic_message_stream<String>& operator<<(basic_message_stream<String>& s,
+                                                    const hexdump_argument& arg)
+    {
+        arg.write(s);
+        return s;
+    }
+
+    /**
+     * @brief Creates an argument writing at most max bytes of the buffer as hex digits, e.g.
+     * log << "received " << hexdump(packet, size). Use hexdump(...).ascii() for a dump with
+     * offsets and an ASCII column.
+     */
+    inline hexdump_argument hexdump(const void* data, std::size_t size, std::size_t max = 256)
+    {
+        return hexdump_argument(data, size, max);
+    }
+} // namespace log
+} // namespace nitro
+
+#endif // INCLUDE_NITRO_LOG_HEXDUMP_HPP
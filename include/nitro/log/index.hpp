@@ -0,0 +1,377 @@
+/*
+ * Copyright (c) 2026, Technische Universität Dresden, Germany
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted
+ * provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+ *    and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to
+ *    endorse or promote products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ * WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef INCLUDE_NITRO_LOG_INDEX_HPP
+#define INCLUDE_NITRO_LOG_INDEX_HPP
+
+#include <nitro/log/severity.hpp>
+#include <nitro/log/timestamp_parser.hpp>
+
+#include <nitro/except/raise.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <string>
+
+
+namespace nitro
+{
+namespace log
+{
+    /**
+     * @brief Options of the sidecar index, which the file sinks write next to their log file,
+     * i.e., into the file with the suffix ".idx".
+     */
+    struct log_index_options
+    {
+        bool enabled = false;
+
+        // a new index entry is started once the current block exceeds this size
+        std::size_t block_size = 64 * 1024;
+
+        std::function<bool(const char*, std::size_t, std::int64_t&)> timestamp_parser =
+            leading_timestamp;
+
+        // extracts the tag of a formatted record, without it blocks are never skipped by tag
+        std::function<bool(const std::string&, std::string&)> tag_parser;
+    };
+
+    /**
+     * @brief Returns a tag parser, which extracts the content of the index-th bracketed field,
+     * e.g. bracketed_field(1) for "[timestamp][tag][severity]: message".
+     */
+    inline std::function<bool(const std::string&, std::string&)> bracketed_field(std::size_t index)
+    {
+        return [index](const std::string& record, std::string& field) {
+            std::size_t pos = 0;
+
+            for (std::size_t i = 0;; ++i)
+            {
+                if (pos >= record.size() || record[pos] != '[')
+                {
+                    return false;
+                }
+
+                auto end = record.find(']', pos);
+                if (end == std::string::npos)
+                {
+                    return false;
+                }
+
+                if (i == index)
+                {
+                    field.assign(record, pos + 1, end - pos - 1);
+                    return true;
+                }
+
+                pos = end + 1;
+            }
+        };
+    }
+
+    /**
+     * @brief Parses the severity from the first bracketed field at the beginning of the record,
+     * which contains a severity name, e.g. "[1596031123][ WARN]: ...".
+     */
+    inline bool bracketed_severity(const std::string& record, severity_level& sev)
+    {
+        static const char* names[] = { "TRACE", "DEBUG", "INFO", "WARN", "ERROR", "FATAL" };
+
+        std::size_t pos = 0;
+
+        while (pos < record.size() && record[pos] == '[')
+        {
+            auto end = record.find(']', pos);
+            if (end == std::string::npos)
+            {
+                return false;
+            }
+
+            auto begin = record.find_first_not_of(' ', pos + 1);
+
+            for (std::size_t i = 0; i < 6; ++i)
+            {
+                auto size = std::strlen(names[i]);
+
+                if (begin + size == end && record.compare(begin, size, names[i]) == 0)
+                {
+                    sev = static_cast<severity_level>(i);
+                    return true;
+                }
+            }
+
+            pos = end + 1;
+        }
+
+        return false;
+    }
+
+    struct log_index_header
+    {
+        // including the terminating null character
+        static const char* magic_value()
+        {
+            return "NLOGIDX";
+        }
+
+        static constexpr std::uint32_t version_value = 1;
+
+        char magic[8];
+        std::uint32_t version;
+        std::uint32_t entry_size;
+        std::uint64_t block_size;
+    };
+
+    /**
+     * @brief Index entry for a block of consecutive records in the log file.
+     */
+    struct log_index_entry
+    {
+        std::uint64_t offset;
+        std::uint64_t size;
+        std::int64_t first_timestamp;
+        std::int64_t last_timestamp;
+        // bloom filter of the tags in the block, all bits are set if tags are not indexed
+        std::uint64_t tag_bloom;
+        // bit i is set, if the block contains a record with severity_level i
+        std::uint8_t severities;
+        std::uint8_t reserved[7];
+    };
+
+    static_assert(sizeof(log_index_entry) == 48, "Unexpected padding in log_index_entry");
+
+    namespace detail
+    {
+        inline std::uint64_t tag_bloom(const char* tag, std::size_t size)
+        {
+            // FNV-1a
+            std::uint64_t hash = 14695981039346656037ull;
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                hash ^= static_cast<unsigned char>(tag[i]);
+                hash *= 1099511628211ull;
+            }
+
+            return (std::uint64_t(1) << (hash & 63)) | (std::uint64_t(1) << ((hash >> 16) & 63)) |
+                   (std::uint64_t(1) << ((hash >> 32) & 63));
+        }
+
+        /**
+         * @brief Writes the index entries for a log file, which is written sequentially and
+         * passed to add() record by record.
+         *
+         * If the log file is appended to, log_size has to be its size before the first record.
+         * The existing index is then continued, a missing or broken one is replaced by an index,
+         * which covers the existing part of the log file by a single block.
+         */
+        class log_index_writer
+        {
+        public:
+            log_index_writer(const std::string& index_file, const log_index_options& options,
+                             std::uint64_t log_size = 0)
+            : options_(options)
+            {
+                std::uint64_t indexed = 0;
+
+                if (log_size > 0 && indexed_size(index_file, indexed) && indexed <= log_size)
+                {
+                    out_.open(index_file, std::ios::binary | std::ios::app);
+                }
+                else
+                {
+                    indexed = 0;
+                    out_.open(index_file, std::ios::binary);
+
+                    log_index_header header;
+                    std::memcpy(header.magic, log_index_header::magic_value(),
+                                sizeof(header.magic));
+                    header.version = log_index_header::version_value;
+                    header.entry_size = sizeof(log_index_entry);
+                    header.block_size = options_.block_size;
+
+                    out_.write(reinterpret_cast<const char*>(&header), sizeof(header));
+                }
+
+                if (!out_)
+                {
+                    raise("Cannot open log index file: ", index_file);
+                }
+
+                // records, which were written without index, can never be skipped
+                entry_.offset = indexed;
+                entry_.size = log_size - indexed;
+                entry_.tag_bloom = ~std::uint64_t(0);
+                entry_.severities = 0xff;
+                finish_block();
+
+                start_block();
+            }
+
+            log_index_writer(const log_index_writer&) = delete;
+            log_index_writer& operator=(const log_index_writer&) = delete;
+
+            ~log_index_writer()
+            {
+                finish_block();
+            }
+
+            void add(severity_level sev, const std::string& record)
+            {
+                if (entry_.size >= options_.block_size)
+                {
+                    finish_block();
+                    start_block();
+                }
+
+                std::int64_t timestamp;
+                if (options_.timestamp_parser &&
+                    options_.timestamp_parser(record.data(), record.size(), timestamp))
+                {
+                    if (!has_timestamp_)
+                    {
+                        entry_.first_timestamp = timestamp;
+                        has_timestamp_ = true;
+                    }
+
+                    entry_.first_timestamp = std::min(entry_.first_timestamp, timestamp);
+                    entry_.last_timestamp = std::max(entry_.last_timestamp, timestamp);
+                }
+
+                if (options_.tag_parser)
+                {
+                    if (options_.tag_parser(record, tag_))
+                    {
+                        entry_.tag_bloom |= tag_bloom(tag_.data(), tag_.size());
+                    }
+                }
+                else
+                {
+                    entry_.tag_bloom = ~std::uint64_t(0);
+                }
+
+                entry_.severities |= static_cast<std::uint8_t>(1u << static_cast<unsigned>(sev));
+                entry_.size += record.size();
+            }
+
+            void flush()
+            {
+                out_.flush();
+            }
+
+        private:
+            // returns the end of the last entry of a valid index file
+            static bool indexed_size(const std::string& index_file, std::uint64_t& size)
+            {
+                std::ifstream in(index_file, std::ios::binary | std::ios::ate);
+
+                if (!in)
+                {
+                    return false;
+                }
+
+                auto file_size = static_cast<std::uint64_t>(in.tellg());
+
+                log_index_header header;
+                in.seekg(0);
+
+                if (file_size < sizeof(header) ||
+                    (file_size - sizeof(header)) % sizeof(log_index_entry) != 0 ||
+                    !in.read(reinterpret_cast<char*>(&header), sizeof(header)) ||
+                    std::memcmp(header.magic, log_index_header::magic_value(),
+                                sizeof(header.magic)) != 0 ||
+                    header.version != log_index_header::version_value ||
+                    header.entry_size != sizeof(log_index_entry))
+                {
+                    return false;
+                }
+
+                size = 0;
+
+                if (file_size == sizeof(header))
+                {
+                    return true;
+                }
+
+                log_index_entry last;
+                in.seekg(static_cast<std::streamoff>(file_size - sizeof(last)));
+
+                if (!in.read(reinterpret_cast<char*>(&last), sizeof(last)))
+                {
+                    return false;
+                }
+
+                size = last.offset + last.size;
+                return true;
+            }
+
+            void start_block()
+            {
+                auto offset = entry_.offset + entry_.size;
+
+                entry_ = log_index_entry();
+                entry_.offset = offset;
+                entry_.first_timestamp = std::numeric_limits<std::int64_t>::max();
+                entry_.last_timestamp = std::numeric_limits<std::int64_t>::min();
+
+                has_timestamp_ = false;
+            }
+
+            void finish_block()
+            {
+                if (entry_.size == 0)
+                {
+                    return;
+                }
+
+                if (!has_timestamp_)
+                {
+                    // cannot be skipped by time
+                    entry_.first_timestamp = std::numeric_limits<std::int64_t>::min();
+                    entry_.last_timestamp = std::numeric_limits<std::int64_t>::max();
+                }
+
+                out_.write(reinterpret_cast<const char*>(&entry_), sizeof(entry_));
+                out_.flush();
+            }
+
+        private:
+            std::ofstream out_;
+            const log_index_options& options_;
+            log_index_entry entry_{};
+            bool has_timestamp_ = false;
+            std::string tag_;
+        };
+    } // namespace detail
+} // namespace log
+} // namespace nitro
+
+#endif // INCLUDE_NITRO_LOG_INDEX_HPP
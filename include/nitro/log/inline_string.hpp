@@ -0,0 +1,475 @@
+/*
+ * Copyright (c) 2026, Technische Universität Dresden, Germany
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted
+ * provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+ *    and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to
+ *    endorse or promote products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ * WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef INCLUDE_NITRO_LOG_INLINE_STRING_HPP
+#define INCLUDE_NITRO_LOG_INLINE_STRING_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <ostream>
+#include <streambuf>
+#include <string>
+
+namespace nitro
+{
+namespace log
+{
+    /**
+     * @brief String, which stores up to Capacity characters inline and falls back to the heap
+     * for longer strings.
+     *
+     * It converts implicitly to std::string, so formatters written for std::string attributes
+     * keep working.
+     */
+    template <std::size_t Capacity>
+    class basic_inline_string
+    {
+    public:
+        basic_inline_string() noexcept : data_(inline_), size_(0), capacity_(Capacity)
+        {
+            inline_[0] = '\0';
+        }
+
+        // nullptr is the empty string, like the tag of NITRO_LOG()
+        basic_inline_string(const char* str) : basic_inline_string()
+        {
+            *this += str;
+        }
+
+        basic_inline_string(const std::string& str) : basic_inline_string()
+        {
+            assign(str.data(), str.size());
+        }
+
+        basic_inline_string(const basic_inline_string& other) : basic_inline_string()
+        {
+            assign(other.data(), other.size());
+        }
+
+        basic_inline_string(basic_inline_string&& other) noexcept : basic_inline_string()
+        {
+            steal(other);
+        }
+
+        ~basic_inline_string()
+        {
+            release();
+        }
+
+        basic_inline_string& operator=(const basic_inline_string& other)
+        {
+            if (this != &other)
+            {
+                assign(other.data(), other.size());
+            }
+
+            return *this;
+        }
+
+        basic_inline_string& operator=(basic_inline_string&& other) noexcept
+        {
+            if (this != &other)
+            {
+                release();
+                steal(other);
+            }
+
+            return *this;
+        }
+
+        basic_inline_string& operator=(const char* str)
+        {
+            size_ = 0;
+            return *this += str;
+        }
+
+        basic_inline_string& operator=(const std::string& str)
+        {
+            assign(str.data(), str.size());
+            return *this;
+        }
+
+        void assign(const char* str, std::size_t size)
+        {
+            size_ = 0;
+            append(str, size);
+        }
+
+        void append(const char* str, std::size_t size)
+        {
+            if (size_ + size > capacity_)
+            {
+                // str may point into this string, so the old buffer is released last
+                auto capacity = std::max(size_ + size, 2 * capacity_);
+
+                auto data = new char[capacity + 1];
+                std::memcpy(data, data_, size_);
+                std::memcpy(data + size_, str, size);
+
+                release();
+
+                data_ = data;
+                capacity_ = capacity;
+            }
+            else
+            {
+                // str may point into this string
+                std::memmove(data_ + size_, str, size);
+            }
+
+            size_ += size;
+            data_[size_] = '\0';
+        }
+
+        void push_back(char c)
+        {
+            reserve(size_ + 1);
+
+            data_[size_++] = c;
+            data_[size_] = '\0';
+        }
+
+        basic_inline_string& operator+=(const std::string& str)
+        {
+            append(str.data(), str.size());
+            return *this;
+        }
+
+        basic_inline_string& operator+=(const char* str)
+        {
+            if (str != nullptr)
+            {
+                append(str, std::strlen(str));
+            }
+            else
+            {
+                data_[size_] = '\0';
+            }
+
+            return *this;
+        }
+
+        void reserve(std::size_t capacity)
+        {
+            if (capacity <= capacity_)
+            {
+                return;
+            }
+
+            capacity = std::max(capacity, 2 * capacity_);
+
+            auto data = new char[capacity + 1];
+            std::memcpy(data, data_, size_ + 1);
+
+            release();
+
+            data_ = data;
+            capacity_ = capacity;
+        }
+
+        // the characters up to the new size have to be written through data() before
+        void set_size(std::size_t size) noexcept
+        {
+            size_ = size;
+            data_[size_] = '\0';
+        }
+
+        void clear() noexcept
+        {
+            size_ = 0;
+            data_[0] = '\0';
+        }
+
+        const char* data() const noexcept
+        {
+            return data_;
+        }
+
+        char* data() noexcept
+        {
+            return data_;
+        }
+
+        const char* c_str() const noexcept
+        {
+            return data_;
+        }
+
+        std::size_t size() const noexcept
+        {
+            return size_;
+        }
+
+        std::size_t capacity() const noexcept
+        {
+            return capacity_;
+        }
+
+        bool empty() const noexcept
+        {
+            return size_ == 0;
+        }
+
+        bool is_inline() const noexcept
+        {
+            return data_ == inline_;
+        }
+
+        const char* begin() const noexcept
+        {
+            return data_;
+        }
+
+        const char* end() const noexcept
+        {
+            return data_ + size_;
+        }
+
+        char operator[](std::size_t i) const noexcept
+        {
+            return data_[i];
+        }
+
+        std::string str() const
+        {
+            return { data_, size_ };
+        }
+
+        operator std::string() const
+        {
+            return str();
+        }
+
+    private:
+        void release() noexcept
+        {
+            if (!is_inline())
+            {
+                delete[] data_;
+
+                data_ = inline_;
+                capacity_ = Capacity;
+            }
+        }
+
+        // requires this string to be released
+        void steal(basic_inline_string& other) noexcept
+        {
+            if (other.is_inline())
+            {
+                std::memcpy(inline_, other.inline_, other.size_ + 1);
+            }
+            else
+            {
+                data_ = other.data_;
+                capacity_ = other.capacity_;
+
+                other.data_ = other.inline_;
+                other.capacity_ = Capacity;
+            }
+
+            size_ = other.size_;
+            other.clear();
+        }
+
+    private:
+        char* data_;
+        std::size_t size_;
+        std::size_t capacity_;
+        char inline_[Capacity + 1];
+    };
+
+    namespace detail
+    {
+        /**
+         * @brief Stream buffer, which writes directly into the storage of an inline string.
+         *
+         * The size of the string is only updated by commit().
+         */
+        template <typename String>
+        class inline_string_buf : public std::streambuf
+        {
+        public:
+            explicit inline_string_buf(String& str) : str_(str)
+            {
+                reset();
+            }
+
+            void commit()
+            {
+                str_.set_size(static_cast<std::size_t>(pptr() - str_.data()));
+            }
+
+            // continues after the current end of the string, if it was modified in between
+            void reset()
+            {
+                setp(str_.data() + str_.size(), str_.data() + str_.capacity());
+            }
+
+        protected:
+            int_type overflow(int_type c) override
+            {
+                commit();
+
+                if (!traits_type::eq_int_type(c, traits_type::eof()))
+                {
+                    str_.push_back(traits_type::to_char_type(c));
+                }
+
+                reset();
+
+                return traits_type::not_eof(c);
+            }
+
+            int sync() override
+            {
+                commit();
+                return 0;
+            }
+
+        private:
+            String& str_;
+        };
+
+        template <typename String>
+        class inline_string_stream : private inline_string_buf<String>, public std::ostream
+        {
+        public:
+            explicit inline_string_stream(String& str)
+            : inline_string_buf<String>(str), std::ostream(static_cast<std::streambuf*>(this))
+            {
+            }
+
+            using inline_string_buf<String>::commit;
+            using inline_string_buf<String>::reset;
+        };
+    } // namespace detail
+
+    template <std::size_t Capacity>
+    inline std::ostream& operator<<(std::ostream& s, const basic_inline_string<Capacity>& str)
+    {
+        return s.write(str.data(), static_cast<std::streamsize>(str.size()));
+    }
+
+    template <std::size_t Capacity>
+    inline bool operator==(const basic_inline_string<Capacity>& a,
+                           const basic_inline_string<Capacity>& b)
+    {
+        return a.size() == b.size() && std::memcmp(a.data(), b.data(), a.size()) == 0;
+    }
+
+    template <std::size_t Capacity>
+    inline bool operator==(const basic_inline_string<Capacity>& a, const std::string& b)
+    {
+        return a.size() == b.size() && std::memcmp(a.data(), b.data(), a.size()) == 0;
+    }
+
+    template <std::size_t Capacity>
+    inline bool operator==(const basic_inline_string<Capacity>& a, const char* b)
+    {
+        return std::strcmp(a.c_str(), b == nullptr ? "" : b) == 0;
+    }
+
+    template <std::size_t Capacity>
+    inline bool operator==(const std::string& a, const basic_inline_string<Capacity>& b)
+    {
+        return b == a;
+    }
+
+    template <std::size_t Capacity>
+    inline bool operator==(const char* a, const basic_inline_string<Capacity>& b)
+    {
+        return b == a;
+    }
+
+    template <std::size_t Capacity>
+    inline bool operator!=(const basic_inline_string<Capacity>& a,
+                           const basic_inline_string<Capacity>& b)
+    {
+        return !(a == b);
+    }
+
+    template <std::size_t Capacity>
+    inline bool operator!=(const basic_inline_string<Capacity>& a, const std::string& b)
+    {
+        return !(a == b);
+    }
+
+    template <std::size_t Capacity>
+    inline bool operator!=(const basic_inline_string<Capacity>& a, const char* b)
+    {
+        return !(a == b);
+    }
+
+    template <std::size_t Capacity>
+    inline bool operator!=(const std::string& a, const basic_inline_string<Capacity>& b)
+    {
+        return !(b == a);
+    }
+
+    template <std::size_t Capacity>
+    inline bool operator!=(const char* a, const basic_inline_string<Capacity>& b)
+    {
+        return !(b == a);
+    }
+
+    template <std::size_t Capacity>
+    inline std::string operator+(const basic_inline_string<Capacity>& a,
+                                 const basic_inline_string<Capacity>& b)
+    {
+        return a.str().append(b.data(), b.size());
+    }
+
+    template <std::size_t Capacity>
+    inline std::string operator+(const basic_inline_string<Capacity>& a, const std::string& b)
+    {
+        return a.str() + b;
+    }
+
+    template <std::size_t Capacity>
+    inline std::string operator+(const basic_inline_string<Capacity>& a, const char* b)
+    {
+        return a.str() + b;
+    }
+
+    template <std::size_t Capacity>
+    inline std::string operator+(std::string a, const basic_inline_string<Capacity>& b)
+    {
+        return a.append(b.data(), b.size());
+    }
+
+    template <std::size_t Capacity>
+    inline std::string operator+(const char* a, const basic_inline_string<Capacity>& b)
+    {
+        return std::string(a).append(b.data(), b.size());
+    }
+} // namespace log
+} // namespace nitro
+
+#endif // INCLUDE_NITRO_LOG_INLINE_STRING_HPP
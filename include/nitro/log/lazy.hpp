@@ -0,0 +1,181 @@
+/*
+ * Copyright (c) 2026, Technische Universität Dresden, Germany
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted
+ * provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+ *    and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to
+ *    endorse or promote products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ * WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef INCLUDE_NITRO_LOG_LAZY_HPP
+#define INCLUDE_NITRO_LOG_LAZY_HPP
+
+#include <nitro/log/message_stream.hpp>
+
+#include <nitro/except/raise.hpp>
+
+#include <cstring>
+#include <ostream>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace nitro
+{
+namespace log
+{
+    /**
+     * @brief Argument for log streams, which is only evaluated if the record gets logged. The
+     * function is called with the output stream and writes into it directly.
+     */
+    template <typename Function>
+    class lazy_argument
+    {
+    public:
+        explicit lazy_argument(Function f) : f_(std::move(f))
+        {
+        }
+
+        template <typename Stream>
+        void write(Stream& s) const
+        {
+            f_(s);
+        }
+
+    private:
+        Function f_;
+    };
+
+    /**
+     * @brief Format string with {} placeholders, whose arguments are captured by value and only
+     * formatted if the record gets logged.
+     */
+    template <typename... Args>
+    class lazy_formatter
+    {
+    public:
+        lazy_formatter(const char* format, std::tuple<Args...> args)
+        : format_(format), args_(std::move(args))
+        {
+        }
+
+        template <typename Stream>
+        void write(Stream& s) const
+        {
+            write_arg(s, format_, std::integral_constant<std::size_t, 0>());
+        }
+
+    private:
+        template <typename Stream, std::size_t I>
+        void write_arg(Stream& s, const char* pos, std::integral_constant<std::size_t, I>) const
+        {
+            auto placeholder = std::strstr(pos, "{}");
+
+            if (placeholder == nullptr)
+            {
+                raise("Provided more arguments than placeholders available in format string");
+            }
+
+            s.write(pos, placeholder - pos);
+            s << std::get<I>(args_);
+
+            write_arg(s, placeholder + 2, std::integral_constant<std::size_t, I + 1>());
+        }
+
+        template <typename Stream>
+        void write_arg(Stream& s, const char* pos,
+                       std::integral_constant<std::size_t, sizeof...(Args)>) const
+        {
+            if (std::strstr(pos, "{}") != nullptr)
+            {
+                raise("Provided less arguments than placeholders needed in format string");
+            }
+
+            s << pos;
+        }
+
+    private:
+        const char* format_;
+        std::tuple<Args...> args_;
+    };
+
+    template <typename Function>
+    inline std::ostream& operator<<(std::ostream& s, const lazy_argument<Function>& arg)
+    {
+        arg.write(s);
+        return s;
+    }
+
+    template <typename... Args>
+    inline std::ostream& operator<<(std::ostream& s, const lazy_formatter<Args...>& arg)
+    {
+        arg.write(s);
+        return s;
+    }
+
+    // lazy arguments, which accept the message stream, e.g. with an auto& parameter, bypass the
+    // std::ostream adapter
+    template <typename String, typename Function,
+              typename = decltype(std::declval<const Function&>()(
+                  std::declval<basic_message_stream<String>&>()))>
+    inline basic_message_stream<String>& operator<<(basic_message_stream<String>& s,
+                                                    const lazy_argument<Function>& arg)
+    {
+        arg.write(s);
+        return s;
+    }
+
+    template <typename String, typename... Args>
+    inline basic_message_stream<String>& operator<<(basic_message_stream<String>& s,
+                                                    const lazy_formatter<Args...>& arg)
+    {
+        arg.write(s);
+        return s;
+    }
+
+    /**
+     * @brief Creates a lazy argument, e.g. log << lazy([&](auto& os) { os << expensive(); }).
+     */
+    template <typename Function>
+    inline lazy_argument<Function> lazy(Function f)
+    {
+        return lazy_argument<Function>(std::move(f));
+    }
+
+    /**
+     * @brief Creates a lazily formatted argument, e.g. log << lazy_format("{}/{}", a, b).
+     *
+     * The format string has to outlive the record, e.g. by being a string literal.
+     */
+    template <typename... Args>
+    inline lazy_formatter<typename std::decay<Args>::type...> lazy_format(const char* format,
+                                                                          Args&&... args)
+    {
+        using tuple_type = std::tuple<typename std::decay<Args>::type...>;
+
+        return { format, tuple_type(std::forward<Args>(args)...) };
+    }
+} // namespace log
+} // namespace nitro
+
+#endif // INCLUDE_NITRO_LOG_LAZY_HPP
@@ -40,6 +40,8 @@ static_assert(std::is_same<decltype(nitro::log::severity_level::NITRO_LOG_MIN_SE
               "NITRO_LOG_MIN_SEVERITY has to be of type nitro::log::severity_level");
 #endif
 
+#include <nitro/log/hexdump.hpp>
+#include <nitro/log/lazy.hpp>
 #include <nitro/log/logger.hpp>
 #include <nitro/log/record.hpp>
 
@@ -29,11 +29,17 @@
 #ifndef INCLUDE_NITRO_LOG_LOGGER_HPP
 #define INCLUDE_NITRO_LOG_LOGGER_HPP
 
+#include <nitro/log/call_site.hpp>
 #include <nitro/log/severity.hpp>
+#include <nitro/log/stats.hpp>
 #include <nitro/log/stream.hpp>
 
 #include <nitro/lang/string_ref.hpp>
 
+#include <chrono>
+#include <cstddef>
+#include <utility>
+
 namespace nitro
 {
 namespace log
@@ -42,14 +48,19 @@ namespace log
     template <typename Clock>
     class timestamp_clock_attribute;
 
+    /**
+     * @brief A logger object with its own sink, formatter and filter objects.
+     *
+     * Unlike the process-wide logger, several instances of the same type can coexist, e.g. one
+     * per subsystem, each with its own sink state like an async queue or an open log file. The
+     * constructor arguments are passed to the sink. Records that are still being written keep
+     * a reference to the instance, so it has to outlive them.
+     */
     template <typename Record, template <typename> class Formater, typename Sink,
               template <typename> class Filter>
-    class logger : Sink, Formater<Record>, Filter<Record>
+    class basic_logger : Sink, Formater<Record>, Filter<Record>
     {
-        using self = logger;
-
-        logger() = default;
-
+    protected:
         template <severity_level Severity>
         using actual_stream_t =
             typename actual_stream<Severity, Record, Formater, Sink, Filter>::type;
@@ -58,6 +69,125 @@ namespace log
             detail::has_attribute_specialization<timestamp_clock_attribute, Record>::value,
             "Record requires a timestamp attribute");
 
+    public:
+        template <typename... Args>
+        explicit basic_logger(Args&&... args) : Sink(std::forward<Args>(args)...)
+        {
+        }
+
+        basic_logger(const basic_logger&) = delete;
+        basic_logger& operator=(const basic_logger&) = delete;
+
+        Sink& sink_instance()
+        {
+            return *this;
+        }
+
+        bool will_log(Record& r)
+        {
+            if (Filter<Record>::filter(r))
+            {
+                return true;
+            }
+
+            detail::stats_filtered();
+            return false;
+        }
+
+        // returns the size of the formatted record
+        std::size_t log(severity_level s, Record& r)
+        {
+            if (!detail::stats_enabled())
+            {
+                auto formatted_record = Formater<Record>::format(r);
+                Sink::sink(s, formatted_record);
+                return formatted_record.size();
+            }
+
+            auto begin = std::chrono::steady_clock::now();
+
+            auto formatted_record = Formater<Record>::format(r);
+            Sink::sink(s, formatted_record);
+
+            detail::stats_logged(s, formatted_record.size(),
+                                 std::chrono::steady_clock::now() - begin);
+
+            return formatted_record.size();
+        }
+
+        actual_stream_t<severity_level::trace> trace(lang::string_ref tag = nullptr)
+        {
+            return actual_stream_t<severity_level::trace>(*this, tag);
+        }
+
+        actual_stream_t<severity_level::trace> trace(call_site& site)
+        {
+            return actual_stream_t<severity_level::trace>(*this, site);
+        }
+
+        actual_stream_t<severity_level::debug> debug(lang::string_ref tag = nullptr)
+        {
+            return actual_stream_t<severity_level::debug>(*this, tag);
+        }
+
+        actual_stream_t<severity_level::debug> debug(call_site& site)
+        {
+            return actual_stream_t<severity_level::debug>(*this, site);
+        }
+
+        actual_stream_t<severity_level::info> info(lang::string_ref tag = nullptr)
+        {
+            return actual_stream_t<severity_level::info>(*this, tag);
+        }
+
+        actual_stream_t<severity_level::info> info(call_site& site)
+        {
+            return actual_stream_t<severity_level::info>(*this, site);
+        }
+
+        actual_stream_t<severity_level::warn> warn(lang::string_ref tag = nullptr)
+        {
+            return actual_stream_t<severity_level::warn>(*this, tag);
+        }
+
+        actual_stream_t<severity_level::warn> warn(call_site& site)
+        {
+            return actual_stream_t<severity_level::warn>(*this, site);
+        }
+
+        actual_stream_t<severity_level::error> error(lang::string_ref tag = nullptr)
+        {
+            return actual_stream_t<severity_level::error>(*this, tag);
+        }
+
+        actual_stream_t<severity_level::error> error(call_site& site)
+        {
+            return actual_stream_t<severity_level::error>(*this, site);
+        }
+
+        actual_stream_t<severity_level::fatal> fatal(lang::string_ref tag = nullptr)
+        {
+            return actual_stream_t<severity_level::fatal>(*this, tag);
+        }
+
+        actual_stream_t<severity_level::fatal> fatal(call_site& site)
+        {
+            return actual_stream_t<severity_level::fatal>(*this, site);
+        }
+    };
+
+    template <typename Record, template <typename> class Formater, typename Sink,
+              template <typename> class Filter>
+    class logger : basic_logger<Record, Formater, Sink, Filter>
+    {
+        using self = logger;
+        using base = basic_logger<Record, Formater, Sink, Filter>;
+
+        logger() = default;
+
+        template <severity_level Severity>
+        using actual_stream_t = typename base::template actual_stream_t<Severity>;
+
     public:
         static self& instance()
         {
@@ -66,44 +196,80 @@ namespace log
             return instance_;
         }
 
+        static Sink& sink_instance()
+        {
+            return instance().base::sink_instance();
+        }
+
         static bool will_log(Record& r)
         {
-            return instance().Filter<Record>::filter(r);
+            return instance().base::will_log(r);
         }
 
-        static void log(severity_level s, Record& r)
+        // returns the size of the formatted record
+        static std::size_t log(severity_level s, Record& r)
         {
-            instance().Sink::sink(s, instance().Formater<Record>::format(r));
+            return instance().base::log(s, r);
         }
 
         static actual_stream_t<severity_level::trace> trace(lang::string_ref tag = nullptr)
         {
-            return actual_stream_t<severity_level::trace>(tag);
+            return instance().base::trace(tag);
+        }
+
+        static actual_stream_t<severity_level::trace> trace(call_site& site)
+        {
+            return instance().base::trace(site);
         }
 
         static actual_stream_t<severity_level::debug> debug(lang::string_ref tag = nullptr)
         {
-            return actual_stream_t<severity_level::debug>(tag);
+            return instance().base::debug(tag);
+        }
+
+        static actual_stream_t<severity_level::debug> debug(call_site& site)
+        {
+            return instance().base::debug(site);
         }
 
         static actual_stream_t<severity_level::info> info(lang::string_ref tag = nullptr)
         {
-            return actual_stream_t<severity_level::info>(tag);
+            return instance().base::info(tag);
+        }
+
+        static actual_stream_t<severity_level::info> info(call_site& site)
+        {
+            return instance().base::info(site);
         }
 
         static actual_stream_t<severity_level::warn> warn(lang::string_ref tag = nullptr)
         {
-            return actual_stream_t<severity_level::warn>(tag);
+            return instance().base::warn(tag);
+        }
+
+        static actual_stream_t<severity_level::warn> warn(call_site& site)
+        {
+            return instance().base::warn(site);
         }
 
         static actual_stream_t<severity_level::error> error(lang::string_ref tag = nullptr)
         {
-            return actual_stream_t<severity_level::error>(tag);
+            return instance().base::error(tag);
+        }
+
+        static actual_stream_t<severity_level::error> error(call_site& site)
+        {
+            return instance().base::error(site);
         }
 
         static actual_stream_t<severity_level::fatal> fatal(lang::string_ref tag = nullptr)
         {
-            return actual_stream_t<severity_level::fatal>(tag);
+            return instance().base::fatal(tag);
+        }
+
+        static actual_stream_t<severity_level::fatal> fatal(call_site& site)
+        {
+            return instance().base::fatal(site);
         }
     };
 } // namespace log
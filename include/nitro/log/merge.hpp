@@ -0,0 +1,275 @@
+/*
+ * Copyright (c) 2026, Technische Universität Dresden, Germany
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted
+ * provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+ *    and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to
+ *    endorse or promote products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ * WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef INCLUDE_NITRO_LOG_MERGE_HPP
+#define INCLUDE_NITRO_LOG_MERGE_HPP
+
+#include <nitro/log/detail/mapped_file.hpp>
+#include <nitro/log/timestamp_parser.hpp>
+
+#include <nitro/except/raise.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <ostream>
+#include <queue>
+#include <string>
+#include <vector>
+
+namespace nitro
+{
+namespace log
+{
+    namespace detail
+    {
+        class logfile_reader
+        {
+        public:
+            using parser_type = std::function<bool(const char*, std::size_t, std::int64_t&)>;
+
+            logfile_reader(const std::string& file_name, const parser_type& parser)
+            : file_(file_name), parser_(parser), pos_(file_.data()), end_(pos_ + file_.size())
+            {
+                file_.sequential();
+            }
+
+            // reads the next record, which spans all lines up to the next one with a timestamp
+            bool next()
+            {
+                if (pos_ == end_)
+                {
+                    return false;
+                }
+
+                record_ = pos_;
+                pos_ = next_line(pos_);
+
+                if (has_lookahead_)
+                {
+                    // the first line was parsed already by the previous call
+                    timestamp_ = lookahead_;
+                }
+                else if (!parse(record_, pos_, timestamp_))
+                {
+                    // lines before the first timestamp go first
+                    timestamp_ = std::numeric_limits<std::int64_t>::min();
+                }
+
+                has_lookahead_ = false;
+
+                while (pos_ != end_)
+                {
+                    auto line_end = next_line(pos_);
+
+                    if (parse(pos_, line_end, lookahead_))
+                    {
+                        has_lookahead_ = true;
+                        break;
+                    }
+
+                    pos_ = line_end;
+                }
+
+                return true;
+            }
+
+            std::int64_t timestamp() const
+            {
+                return timestamp_;
+            }
+
+            // the record including its line breaks, only the last line of a file may lack one
+            const char* data() const
+            {
+                return record_;
+            }
+
+            std::size_t size() const
+            {
+                return pos_ - record_;
+            }
+
+        private:
+            const char* next_line(const char* pos) const
+            {
+                auto newline = static_cast<const char*>(std::memchr(pos, '\n', end_ - pos));
+                return newline == nullptr ? end_ : newline + 1;
+            }
+
+            // parses the line in place in the mapped file
+            bool parse(const char* begin, const char* end, std::int64_t& timestamp)
+            {
+                if (end != begin && end[-1] == '\n')
+                {
+                    --end;
+                }
+
+                return parser_(begin, static_cast<std::size_t>(end - begin), timestamp);
+            }
+
+        private:
+            mapped_file file_;
+            const parser_type& parser_;
+            const char* pos_;
+            const char* end_;
+            const char* record_ = nullptr;
+            std::int64_t timestamp_ = 0;
+            std::int64_t lookahead_ = 0;
+            bool has_lookahead_ = false;
+        };
+
+        // collects the merged records to write them to the stream in large chunks
+        class merge_output
+        {
+        public:
+            explicit merge_output(std::ostream& output, std::size_t capacity = 1024 * 1024)
+            : output_(output), capacity_(capacity)
+            {
+                buffer_.reserve(capacity_);
+            }
+
+            ~merge_output()
+            {
+                flush();
+            }
+
+            void write(const char* data, std::size_t size)
+            {
+                if (buffer_.size() + size > capacity_)
+                {
+                    flush();
+                }
+
+                if (size >= capacity_)
+                {
+                    output_.write(data, size);
+                }
+                else
+                {
+                    buffer_.append(data, size);
+                }
+            }
+
+            void write_record(const logfile_reader& reader)
+            {
+                write(reader.data(), reader.size());
+
+                if (reader.data()[reader.size() - 1] != '\n')
+                {
+                    write("\n", 1);
+                }
+            }
+
+            void flush()
+            {
+                output_.write(buffer_.data(), buffer_.size());
+                buffer_.clear();
+            }
+
+        private:
+            std::ostream& output_;
+            std::size_t capacity_;
+            std::string buffer_;
+        };
+    } // namespace detail
+
+    /**
+     * @brief Merges log files, e.g. the shards written by sink::ShardedLogfile, ordered by the
+     * timestamps of their records.
+     *
+     * Every input has to be ordered by time already. Lines without a timestamp belong to the
+     * record before. Records with equal timestamps are written in the order of the inputs. The
+     * inputs are memory mapped and the output is written in chunks of one MiB.
+     */
+    inline void merge_logfiles(
+        const std::vector<std::string>& inputs, std::ostream& output,
+        std::function<bool(const char*, std::size_t, std::int64_t&)> parser = leading_timestamp)
+    {
+        std::vector<std::unique_ptr<detail::logfile_reader>> readers;
+
+        using head = std::pair<std::int64_t, std::size_t>;
+        std::priority_queue<head, std::vector<head>, std::greater<head>> heads;
+
+        for (auto& input : inputs)
+        {
+            readers.emplace_back(new detail::logfile_reader(input, parser));
+
+            if (readers.back()->next())
+            {
+                heads.emplace(readers.back()->timestamp(), readers.size() - 1);
+            }
+        }
+
+        detail::merge_output out(output);
+
+        while (!heads.empty())
+        {
+            auto index = heads.top().second;
+            heads.pop();
+
+            auto& reader = *readers[index];
+            bool more;
+
+            // consume the run of records, which go before the next head, without heap updates
+            do
+            {
+                out.write_record(reader);
+                more = reader.next();
+            } while (more && (heads.empty() || head(reader.timestamp(), index) < heads.top()));
+
+            if (more)
+            {
+                heads.emplace(reader.timestamp(), index);
+            }
+        }
+    }
+
+    /**
+     * @brief Merges log files into the given output file.
+     */
+    inline void merge_logfiles(
+        const std::vector<std::string>& inputs, const std::string& output_file,
+        std::function<bool(const char*, std::size_t, std::int64_t&)> parser = leading_timestamp)
+    {
+        std::ofstream output(output_file, std::ios::binary);
+
+        if (!output)
+        {
+            raise("Cannot open output file: ", output_file);
+        }
+
+        merge_logfiles(inputs, output, std::move(parser));
+    }
+} // namespace log
+} // namespace nitro
+
+#endif // INCLUDE_NITRO_LOG_MERGE_HPP
@@ -0,0 +1,507 @@
+/*
+ * Copyright (c) 2026, Technische Universität Dresden, Germany
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted
+ * provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+ *    and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to
+ *    endorse or promote products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ * WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef INCLUDE_NITRO_LOG_MESSAGE_STREAM_HPP
+#define INCLUDE_NITRO_LOG_MESSAGE_STREAM_HPP
+
+#include <nitro/log/attribute/message.hpp>
+#include <nitro/log/inline_string.hpp>
+#include <nitro/log/severity.hpp>
+
+#include <nitro/lang/string_ref.hpp>
+
+#include <cstdio>
+#include <cstring>
+#include <ios>
+#include <memory>
+#include <ostream>
+#include <streambuf>
+#include <string>
+#include <type_traits>
+
+#if __cplusplus >= 201703L && defined(__has_include)
+#if __has_include(<charconv>)
+#include <charconv>
+#endif
+#endif
+
+namespace nitro
+{
+namespace log
+{
+    namespace detail
+    {
+        /**
+         * @brief Stream buffer appending to a string without direct access to its storage,
+         * e.g. a std::string.
+         */
+        template <typename String>
+        class string_append_buf : public std::streambuf
+        {
+        public:
+            explicit string_append_buf(String& str) : str_(str)
+            {
+            }
+
+        protected:
+            int_type overflow(int_type c) override
+            {
+                if (!traits_type::eq_int_type(c, traits_type::eof()))
+                {
+                    str_.push_back(traits_type::to_char_type(c));
+                }
+
+                return traits_type::not_eof(c);
+            }
+
+            std::streamsize xsputn(const char* s, std::streamsize count) override
+            {
+                str_.append(s, static_cast<std::size_t>(count));
+                return count;
+            }
+
+        private:
+            String& str_;
+        };
+
+        template <typename String>
+        class string_append_stream : private string_append_buf<String>, public std::ostream
+        {
+        public:
+            explicit string_append_stream(String& str)
+            : string_append_buf<String>(str), std::ostream(static_cast<std::streambuf*>(this))
+            {
+            }
+
+            // the buffer is unbuffered, so there is nothing to synchronize
+            void commit()
+            {
+            }
+
+            void reset()
+            {
+            }
+        };
+
+        template <typename String>
+        struct message_stream_adapter
+        {
+            using type = string_append_stream<String>;
+        };
+
+        template <std::size_t Capacity>
+        struct message_stream_adapter<basic_inline_string<Capacity>>
+        {
+            using type = inline_string_stream<basic_inline_string<Capacity>>;
+        };
+
+        // appends size uninitialized characters and returns a pointer to them
+        inline char* extend_string(std::string& str, std::size_t size)
+        {
+            auto old_size = str.size();
+            str.resize(old_size + size);
+            return &str[old_size];
+        }
+
+        template <std::size_t Capacity>
+        inline char* extend_string(basic_inline_string<Capacity>& str, std::size_t size)
+        {
+            auto old_size = str.size();
+            str.reserve(old_size + size);
+            str.set_size(old_size + size);
+            return str.data() + old_size;
+        }
+    } // namespace detail
+
+    /**
+     * @brief Light-weight output stream, which appends directly to a string, i.e., a
+     * basic_inline_string or a std::string.
+     *
+     * Characters, strings, string_ref, severity_level and arithmetic types are written without
+     * a std::ostream, i.e., without locale and stream state, with the same output as a default
+     * constructed std::ostream. All other types and manipulators are written through a
+     * std::ostream adapter, which is only created on first use. Once a manipulator changed the
+     * state of the adapter, e.g. std::hex, all following values of the record are written
+     * through the adapter, so its state applies to them.
+     */
+    template <typename String>
+    class basic_message_stream
+    {
+    public:
+        basic_message_stream() = default;
+
+        explicit basic_message_stream(String& str) : str_(&str)
+        {
+        }
+
+        basic_message_stream& operator<<(char c)
+        {
+            if (formatted_)
+            {
+                return write_formatted(c);
+            }
+
+            str_->push_back(c);
+            return *this;
+        }
+
+        basic_message_stream& operator<<(signed char c)
+        {
+            return *this << static_cast<char>(c);
+        }
+
+        basic_message_stream& operator<<(unsigned char c)
+        {
+            return *this << static_cast<char>(c);
+        }
+
+        basic_message_stream& operator<<(const char* str)
+        {
+            if (str == nullptr)
+            {
+                return *this;
+            }
+
+            if (formatted_)
+            {
+                return write_formatted(str);
+            }
+
+            str_->append(str, std::strlen(str));
+            return *this;
+        }
+
+        basic_message_stream& operator<<(char* str)
+        {
+            return *this << static_cast<const char*>(str);
+        }
+
+        basic_message_stream& operator<<(const std::string& str)
+        {
+            if (formatted_)
+            {
+                return write_formatted(str);
+            }
+
+            str_->append(str.data(), str.size());
+            return *this;
+        }
+
+        basic_message_stream& operator<<(lang::string_ref str)
+        {
+            return *this << str.get();
+        }
+
+        template <std::size_t Capacity>
+        basic_message_stream& operator<<(const basic_inline_string<Capacity>& str)
+        {
+            if (formatted_)
+            {
+                return write_formatted(str);
+            }
+
+            str_->append(str.data(), str.size());
+            return *this;
+        }
+
+        basic_message_stream& operator<<(severity_level sev)
+        {
+            return log::operator<<(*this, sev);
+        }
+
+        basic_message_stream& operator<<(bool value)
+        {
+            return *this << (value ? '1' : '0');
+        }
+
+        basic_message_stream& operator<<(short value)
+        {
+            return write_integer(value);
+        }
+
+        basic_message_stream& operator<<(unsigned short value)
+        {
+            return write_integer(value);
+        }
+
+        basic_message_stream& operator<<(int value)
+        {
+            return write_integer(value);
+        }
+
+        basic_message_stream& operator<<(unsigned int value)
+        {
+            return write_integer(value);
+        }
+
+        basic_message_stream& operator<<(long value)
+        {
+            return write_integer(value);
+        }
+
+        basic_message_stream& operator<<(unsigned long value)
+        {
+            return write_integer(value);
+        }
+
+        basic_message_stream& operator<<(long long value)
+        {
+            return write_integer(value);
+        }
+
+        basic_message_stream& operator<<(unsigned long long value)
+        {
+            return write_integer(value);
+        }
+
+        basic_message_stream& operator<<(float value)
+        {
+            return write_floating(value);
+        }
+
+        basic_message_stream& operator<<(double value)
+        {
+            return write_floating(value);
+        }
+
+        basic_message_stream& operator<<(long double value)
+        {
+            return write_floating(value);
+        }
+
+        basic_message_stream& operator<<(std::ostream& (*manipulator)(std::ostream&))
+        {
+            return write_formatted(manipulator);
+        }
+
+        basic_message_stream& operator<<(std::ios_base& (*manipulator)(std::ios_base&))
+        {
+            return write_formatted(manipulator);
+        }
+
+        // fallback for all types with an operator<< for std::ostream
+        template <typename T>
+        basic_message_stream& operator<<(const T& value)
+        {
+            return write_formatted(value);
+        }
+
+        void write(const char* str, std::size_t size)
+        {
+            if (formatted_)
+            {
+                adapter().write(str, static_cast<std::streamsize>(size));
+                adapter_->commit();
+                return;
+            }
+
+            str_->append(str, size);
+        }
+
+        /**
+         * @brief Calls the encoder with a pointer to size characters appended to the string,
+         * which it has to fill completely, e.g. for encoders writing directly into the message.
+         */
+        template <typename Encoder>
+        void write_direct(std::size_t size, Encoder&& encoder)
+        {
+            if (formatted_)
+            {
+                std::string buffer(size, '\0');
+                encoder(&buffer[0]);
+                write(buffer.data(), size);
+                return;
+            }
+
+            encoder(detail::extend_string(*str_, size));
+        }
+
+        /**
+         * @brief Returns the std::ostream adapter, e.g. to pass the stream to functions expecting
+         * a std::ostream. Writes to it are only visible in the string after the next operation
+         * on this stream or flush().
+         */
+        std::ostream& ostream()
+        {
+            auto& stream = adapter();
+
+            formatted_ = true;
+            pending_ = true;
+
+            return stream;
+        }
+
+        void flush()
+        {
+            if (pending_)
+            {
+                adapter_->commit();
+                pending_ = false;
+            }
+        }
+
+        const String& str()
+        {
+            flush();
+            return *str_;
+        }
+
+    private:
+        using adapter_type = typename detail::message_stream_adapter<String>::type;
+
+        adapter_type& adapter()
+        {
+            flush();
+
+            if (!adapter_)
+            {
+                adapter_.reset(new adapter_type(*str_));
+            }
+            else
+            {
+                adapter_->reset();
+            }
+
+            return *adapter_;
+        }
+
+        template <typename T>
+        basic_message_stream& write_formatted(const T& value)
+        {
+            auto& stream = adapter();
+
+            stream << value;
+            adapter_->commit();
+
+            if (!formatted_)
+            {
+                // switch to the adapter, if a manipulator changed its state
+                formatted_ = stream.flags() != (std::ios_base::skipws | std::ios_base::dec) ||
+                             stream.width() != 0 || stream.precision() != 6 ||
+                             stream.fill() != ' ';
+            }
+
+            return *this;
+        }
+
+        template <typename T>
+        basic_message_stream& write_integer(T value)
+        {
+            if (formatted_)
+            {
+                return write_formatted(value);
+            }
+
+            using unsigned_type = typename std::make_unsigned<T>::type;
+
+            static const char digits[] = "00010203040506070809"
+                                         "10111213141516171819"
+                                         "20212223242526272829"
+                                         "30313233343536373839"
+                                         "40414243444546474849"
+                                         "50515253545556575859"
+                                         "60616263646566676869"
+                                         "70717273747576777879"
+                                         "80818283848586878889"
+                                         "90919293949596979899";
+
+            char buffer[24];
+            char* end = buffer + sizeof(buffer);
+            char* pos = end;
+
+            auto abs = static_cast<unsigned_type>(value);
+            if (value < 0)
+            {
+                abs = static_cast<unsigned_type>(0 - abs);
+            }
+
+            while (abs >= 100)
+            {
+                auto index = static_cast<std::size_t>(abs % 100) * 2;
+                abs /= 100;
+                *--pos = digits[index + 1];
+                *--pos = digits[index];
+            }
+
+            if (abs >= 10)
+            {
+                auto index = static_cast<std::size_t>(abs) * 2;
+                *--pos = digits[index + 1];
+                *--pos = digits[index];
+            }
+            else
+            {
+                *--pos = static_cast<char>('0' + abs);
+            }
+
+            if (value < 0)
+            {
+                *--pos = '-';
+            }
+
+            str_->append(pos, static_cast<std::size_t>(end - pos));
+            return *this;
+        }
+
+        template <typename T>
+        basic_message_stream& write_floating(T value)
+        {
+            if (formatted_)
+            {
+                return write_formatted(value);
+            }
+
+            // same as the default of std::ostream, i.e., %g with a precision of 6
+            char buffer[64];
+
+#if defined(__cpp_lib_to_chars)
+            auto result =
+                std::to_chars(buffer, buffer + sizeof(buffer), value, std::chars_format::general, 6);
+            auto size = static_cast<std::size_t>(result.ptr - buffer);
+#else
+            auto size = static_cast<std::size_t>(
+                std::snprintf(buffer, sizeof(buffer), "%Lg", static_cast<long double>(value)));
+#endif
+
+            str_->append(buffer, size);
+            return *this;
+        }
+
+    private:
+        String* str_ = nullptr;
+        std::unique_ptr<adapter_type> adapter_;
+        bool formatted_ = false;
+        // whether the adapter was handed out by ostream() and may contain uncommitted output
+        bool pending_ = false;
+    };
+
+    using message_stream = basic_message_stream<message_string>;
+} // namespace log
+} // namespace nitro
+
+#endif // INCLUDE_NITRO_LOG_MESSAGE_STREAM_HPP
@@ -0,0 +1,278 @@
+/*
+ * Copyright (c) 2026, Technische Universität Dresden, Germany
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted
+ * provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+ *    and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to
+ *    endorse or promote products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ * WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef INCLUDE_NITRO_LOG_QUERY_HPP
+#define INCLUDE_NITRO_LOG_QUERY_HPP
+
+#include <nitro/log/detail/mapped_file.hpp>
+#include <nitro/log/index.hpp>
+#include <nitro/log/severity.hpp>
+
+#include <nitro/except/raise.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <ostream>
+#include <string>
+
+namespace nitro
+{
+namespace log
+{
+    /**
+     * @brief Read-only view of a log index file.
+     */
+    class log_index
+    {
+    public:
+        explicit log_index(const std::string& index_file) : file_(index_file)
+        {
+            log_index_header header;
+
+            if (file_.size() < sizeof(header))
+            {
+                raise("Invalid log index file: ", index_file);
+            }
+
+            std::memcpy(&header, file_.data(), sizeof(header));
+
+            auto magic = log_index_header::magic_value();
+
+            if (std::memcmp(header.magic, magic, sizeof(header.magic)) != 0 ||
+                header.version != log_index_header::version_value ||
+                header.entry_size != sizeof(log_index_entry))
+            {
+                raise("Invalid log index file: ", index_file);
+            }
+
+            begin_ = reinterpret_cast<const log_index_entry*>(file_.data() + sizeof(header));
+            end_ = begin_ + (file_.size() - sizeof(header)) / sizeof(log_index_entry);
+        }
+
+        const log_index_entry* begin() const
+        {
+            return begin_;
+        }
+
+        const log_index_entry* end() const
+        {
+            return end_;
+        }
+
+        std::size_t size() const
+        {
+            return static_cast<std::size_t>(end_ - begin_);
+        }
+
+    private:
+        detail::mapped_file file_;
+        const log_index_entry* begin_;
+        const log_index_entry* end_;
+    };
+
+    struct log_query
+    {
+        std::int64_t from = std::numeric_limits<std::int64_t>::min();
+        std::int64_t to = std::numeric_limits<std::int64_t>::max();
+        severity_level min_severity = severity_level::trace;
+        // empty matches all tags
+        std::string tag;
+    };
+
+    namespace detail
+    {
+        class log_query_scanner
+        {
+        public:
+            log_query_scanner(const log_query& query, const log_index_options& options,
+                              std::ostream& output)
+            : query_(query), options_(options), output_(output)
+            {
+            }
+
+            // writes the matching records in the range, which has to start with a record
+            std::size_t scan(const char* begin, const char* end)
+            {
+                std::size_t matches = 0;
+                auto record = begin;
+
+                while (record < end)
+                {
+                    auto line_end = next_line(record, end);
+
+                    // continuation lines have no timestamp
+                    auto record_end = line_end;
+                    std::int64_t ignored;
+                    while (record_end < end &&
+                           !parse_timestamp(record_end, next_line(record_end, end), ignored))
+                    {
+                        record_end = next_line(record_end, end);
+                    }
+
+                    if (matches_query(record, line_end))
+                    {
+                        output_.write(record, record_end - record);
+                        ++matches;
+                    }
+
+                    record = record_end;
+                }
+
+                return matches;
+            }
+
+        private:
+            static const char* next_line(const char* pos, const char* end)
+            {
+                auto newline = static_cast<const char*>(std::memchr(pos, '\n', end - pos));
+                return newline == nullptr ? end : newline + 1;
+            }
+
+            // parses the line in place in the mapped file
+            bool parse_timestamp(const char* begin, const char* end, std::int64_t& timestamp)
+            {
+                return options_.timestamp_parser(begin, static_cast<std::size_t>(end - begin),
+                                                 timestamp);
+            }
+
+            bool matches_query(const char* line, const char* line_end)
+            {
+                std::int64_t timestamp;
+                if (parse_timestamp(line, line_end, timestamp) &&
+                    (timestamp < query_.from || timestamp > query_.to))
+                {
+                    return false;
+                }
+
+                if (query_.min_severity == severity_level::trace && query_.tag.empty())
+                {
+                    return true;
+                }
+
+                // the severity and tag parsers need a copy
+                first_line_.assign(line, line_end);
+
+                severity_level sev;
+                if (query_.min_severity != severity_level::trace &&
+                    bracketed_severity(first_line_, sev) && sev < query_.min_severity)
+                {
+                    return false;
+                }
+
+                if (!query_.tag.empty() &&
+                    (!options_.tag_parser(first_line_, tag_) || tag_ != query_.tag))
+                {
+                    return false;
+                }
+
+                return true;
+            }
+
+        private:
+            const log_query& query_;
+            const log_index_options& options_;
+            std::ostream& output_;
+            std::string first_line_;
+            std::string tag_;
+        };
+    } // namespace detail
+
+    /**
+     * @brief Writes all records of the log file, which match the query, to the output and
+     * returns their number.
+     *
+     * If the sidecar index log_file + ".idx" exists, only the blocks, which may contain matching
+     * records, are read. Otherwise the whole file is scanned. The options have to match the
+     * ones used for writing the index. Filtering by tag requires a tag_parser.
+     */
+    inline std::size_t query_logfile(const std::string& log_file, const log_query& query,
+                                     std::ostream& output,
+                                     const log_index_options& options = log_index_options())
+    {
+        if (!query.tag.empty() && !options.tag_parser)
+        {
+            raise("Querying log files by tag requires a tag parser");
+        }
+
+        detail::mapped_file file(log_file);
+        detail::log_query_scanner scanner(query, options, output);
+
+        auto data = file.data();
+        std::size_t scanned = 0;
+        std::size_t matches = 0;
+
+        std::ifstream index_file(log_file + ".idx");
+        if (index_file)
+        {
+            index_file.close();
+
+            log_index index(log_file + ".idx");
+
+            std::uint8_t severity_mask = static_cast<std::uint8_t>(
+                0x3fu & (0x3fu << static_cast<unsigned>(query.min_severity)));
+            auto bloom =
+                query.tag.empty() ? 0 : detail::tag_bloom(query.tag.data(), query.tag.size());
+
+            // entries are ordered by time, as long as the records in the log file are
+            auto first = std::partition_point(
+                index.begin(), index.end(),
+                [&query](const log_index_entry& e) { return e.last_timestamp < query.from; });
+
+            for (auto entry = first; entry != index.end() && entry->first_timestamp <= query.to;
+                 ++entry)
+            {
+                if ((entry->severities & severity_mask) == 0 ||
+                    (entry->tag_bloom & bloom) != bloom ||
+                    entry->offset + entry->size > file.size())
+                {
+                    continue;
+                }
+
+                file.will_need(entry->offset, entry->size);
+                matches += scanner.scan(data + entry->offset, data + entry->offset + entry->size);
+            }
+
+            if (index.size() > 0)
+            {
+                auto& last = *(index.end() - 1);
+                scanned = std::min<std::size_t>(last.offset + last.size, file.size());
+            }
+        }
+
+        // the records after the last index entry, e.g. if the writer did not finish
+        matches += scanner.scan(data + scanned, data + file.size());
+
+        return matches;
+    }
+} // namespace log
+} // namespace nitro
+
+#endif // INCLUDE_NITRO_LOG_QUERY_HPP
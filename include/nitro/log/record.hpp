@@ -31,18 +31,67 @@
 
 #include <nitro/log/attribute/message.hpp>
 #include <nitro/log/detail/has_attribute.hpp>
+#include <nitro/log/detail/record_layout.hpp>
+
+#include <cstddef>
 
 namespace nitro
 {
 namespace log
 {
 
+    /**
+     * @brief A log record with the given attributes.
+     *
+     * The attributes are stored sorted by alignment and size instead of the declared order, so
+     * that there is no padding between them. The record still derives from every attribute, so
+     * their accessors are unchanged. Use record_layout to check the resulting size.
+     */
     template <typename... Attributes>
-    class record : public Attributes...
+    class record : public detail::record_storage<detail::sorted_attributes<Attributes...>>
     {
         static_assert(detail::has_attribute<message_attribute, record>::value,
                       "Record must have a message attribute!");
     };
+
+    /**
+     * @brief Size report of a record, e.g. for static_assert(record_layout<R>::padding() == 0).
+     *
+     * size() is the actual size of the record and declared_size() the size it would have with
+     * the attributes in declared order. attributes_size() is the sum of the sizes of all
+     * non-empty attributes and padding() the difference to size().
+     */
+    template <typename Record>
+    struct record_layout;
+
+    template <typename... Attributes>
+    struct record_layout<record<Attributes...>>
+    {
+        static constexpr std::size_t size()
+        {
+            return sizeof(record<Attributes...>);
+        }
+
+        static constexpr std::size_t declared_size()
+        {
+            return sizeof(detail::record_storage<detail::type_list<Attributes...>>);
+        }
+
+        static constexpr std::size_t attributes_size()
+        {
+            return detail::attributes_size<Attributes...>::value();
+        }
+
+        static constexpr std::size_t padding()
+        {
+            return size() > attributes_size() ? size() - attributes_size() : 0;
+        }
+
+        static constexpr std::size_t saved()
+        {
+            return declared_size() > size() ? declared_size() - size() : 0;
+        }
+    };
 } // namespace log
 } // namespace nitro
 
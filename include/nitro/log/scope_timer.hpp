@@ -0,0 +1,369 @@
+/*
+ * Copyright (c) 2026, Technische Universität Dresden, Germany
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted
+ * provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+ *    and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to
+ *    endorse or promote products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ * WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef INCLUDE_NITRO_LOG_SCOPE_TIMER_HPP
+#define INCLUDE_NITRO_LOG_SCOPE_TIMER_HPP
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+namespace nitro
+{
+namespace log
+{
+    /**
+     * @brief Summary of the durations measured by all scope_timer with the same tag on one thread
+     * since the last summary.
+     */
+    struct timer_summary
+    {
+        std::string tag;
+        std::uint64_t count = 0;
+        std::chrono::nanoseconds min{ 0 };
+        std::chrono::nanoseconds p50{ 0 };
+        std::chrono::nanoseconds p99{ 0 };
+        std::chrono::nanoseconds max{ 0 };
+    };
+
+    inline std::ostream& operator<<(std::ostream& s, const timer_summary& summary)
+    {
+        s << "count=" << summary.count << " min=" << summary.min.count()
+          << "ns p50=" << summary.p50.count() << "ns p99=" << summary.p99.count()
+          << "ns max=" << summary.max.count() << "ns";
+
+        return s;
+    }
+
+    namespace detail
+    {
+        /**
+         * @brief Histogram with logarithmic buckets, each split into 16 linear sub-buckets.
+         *
+         * Values below 32 are exact, for larger values the relative error is below 1/16.
+         */
+        class timer_histogram
+        {
+        public:
+            static constexpr unsigned sub_bucket_bits = 4;
+            static constexpr std::size_t sub_buckets = std::size_t(1) << sub_bucket_bits;
+            static constexpr std::size_t bucket_count = (64 - sub_bucket_bits + 1) * sub_buckets;
+
+            void record(std::uint64_t value)
+            {
+                ++counts_[index(value)];
+
+                if (count_ == 0 || value < min_)
+                {
+                    min_ = value;
+                }
+
+                max_ = std::max(max_, value);
+                ++count_;
+            }
+
+            std::uint64_t count() const
+            {
+                return count_;
+            }
+
+            std::uint64_t min() const
+            {
+                return min_;
+            }
+
+            std::uint64_t max() const
+            {
+                return max_;
+            }
+
+            // highest value of the bucket containing the quantile, clamped to [min, max]
+            std::uint64_t quantile(double quantile) const
+            {
+                auto rank = static_cast<std::uint64_t>(quantile * count_);
+                std::uint64_t seen = 0;
+
+                for (std::size_t i = 0; i < bucket_count; ++i)
+                {
+                    seen += counts_[i];
+
+                    if (seen > rank)
+                    {
+                        return std::min(std::max(highest_value(i), min_), max_);
+                    }
+                }
+
+                return max_;
+            }
+
+            void reset()
+            {
+                counts_.fill(0);
+                count_ = 0;
+                min_ = 0;
+                max_ = 0;
+            }
+
+            static std::size_t index(std::uint64_t value)
+            {
+                unsigned msb = 0;
+                for (unsigned step = 32; step > 0; step /= 2)
+                {
+                    if ((value >> (msb + step)) != 0)
+                    {
+                        msb += step;
+                    }
+                }
+
+                unsigned shift = msb > sub_bucket_bits ? msb - sub_bucket_bits : 0;
+
+                return shift * sub_buckets + static_cast<std::size_t>(value >> shift);
+            }
+
+            static std::uint64_t highest_value(std::size_t index)
+            {
+                if (index < 2 * sub_buckets)
+                {
+                    return index;
+                }
+
+                auto shift = index / sub_buckets - 1;
+                auto sub_bucket = index - shift * sub_buckets;
+
+                return ((std::uint64_t(sub_bucket) + 1) << shift) - 1;
+            }
+
+        private:
+            std::array<std::uint64_t, bucket_count> counts_{};
+            std::uint64_t count_ = 0;
+            std::uint64_t min_ = 0;
+            std::uint64_t max_ = 0;
+        };
+
+        class timer_registry
+        {
+        public:
+            static timer_registry& instance()
+            {
+                static timer_registry registry;
+                return registry;
+            }
+
+            // in nanoseconds
+            std::atomic<std::int64_t> interval{ 10000000000 };
+
+            void set_reporter(std::function<void(const timer_summary&)> reporter)
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                reporter_ = std::move(reporter);
+            }
+
+            void report(const timer_summary& summary)
+            {
+                std::function<void(const timer_summary&)> reporter;
+
+                {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    reporter = reporter_;
+                }
+
+                if (reporter)
+                {
+                    reporter(summary);
+                }
+            }
+
+        private:
+            timer_registry() = default;
+
+            std::mutex mutex_;
+            std::function<void(const timer_summary&)> reporter_;
+        };
+
+        class timer_thread_state
+        {
+        public:
+            timer_thread_state()
+            : registry_(timer_registry::instance()), last_report_(std::chrono::steady_clock::now())
+            {
+            }
+
+            timer_thread_state(const timer_thread_state&) = delete;
+            timer_thread_state& operator=(const timer_thread_state&) = delete;
+
+            ~timer_thread_state()
+            {
+                report();
+            }
+
+            static timer_thread_state& instance()
+            {
+                static thread_local timer_thread_state state;
+                return state;
+            }
+
+            // histograms are never removed, so the returned reference stays valid
+            timer_histogram& histogram(const char* tag)
+            {
+                // reuses the capacity of key_, so looking up a known tag does not allocate
+                key_.assign(tag);
+                return histograms_[key_];
+            }
+
+            void maybe_report(std::chrono::steady_clock::time_point now)
+            {
+                auto elapsed =
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(now - last_report_);
+
+                if (elapsed.count() >= registry_.interval.load(std::memory_order_relaxed))
+                {
+                    report();
+                    last_report_ = now;
+                }
+            }
+
+            void report()
+            {
+                for (auto& entry : histograms_)
+                {
+                    auto& histogram = entry.second;
+
+                    if (histogram.count() == 0)
+                    {
+                        continue;
+                    }
+
+                    timer_summary summary;
+                    summary.tag = entry.first;
+                    summary.count = histogram.count();
+                    summary.min = std::chrono::nanoseconds(histogram.min());
+                    summary.p50 = std::chrono::nanoseconds(histogram.quantile(0.5));
+                    summary.p99 = std::chrono::nanoseconds(histogram.quantile(0.99));
+                    summary.max = std::chrono::nanoseconds(histogram.max());
+
+                    histogram.reset();
+
+                    registry_.report(summary);
+                }
+            }
+
+        private:
+            timer_registry& registry_;
+            std::unordered_map<std::string, timer_histogram> histograms_;
+            std::string key_;
+            std::chrono::steady_clock::time_point last_report_;
+        };
+    } // namespace detail
+
+    /**
+     * @brief Sets the function, which receives the timer summaries. Without one, the summaries
+     * are discarded.
+     */
+    inline void set_timer_reporter(std::function<void(const timer_summary&)> reporter)
+    {
+        detail::timer_registry::instance().set_reporter(std::move(reporter));
+    }
+
+    /**
+     * @brief Emits the timer summaries as info records with the timer's tag through the given
+     * logger.
+     */
+    template <typename Logger>
+    inline void report_timers_to()
+    {
+        set_timer_reporter(
+            [](const timer_summary& summary) { Logger::info(summary.tag) << summary; });
+    }
+
+    /**
+     * @brief Sets the minimal interval between two summaries of a thread. It is checked whenever
+     * a scope_timer of this thread ends. The default is ten seconds.
+     */
+    template <typename Rep, typename Period>
+    inline void set_timer_interval(std::chrono::duration<Rep, Period> interval)
+    {
+        detail::timer_registry::instance().interval.store(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(interval).count(),
+            std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Emits the summaries of the current thread now. This also happens on thread exit.
+     */
+    inline void flush_timers()
+    {
+        detail::timer_thread_state::instance().report();
+    }
+
+    /**
+     * @brief Measures the time until the end of its scope and adds it to the histogram of its tag
+     * and thread, e.g. nitro::log::scope_timer timer("solve").
+     *
+     * The histograms are keyed by the contents of the tag, so timers with equal tags share one
+     * histogram, even if the tag is a temporary string.
+     */
+    class scope_timer
+    {
+    public:
+        explicit scope_timer(const char* tag)
+        : histogram_(detail::timer_thread_state::instance().histogram(tag)),
+          begin_(std::chrono::steady_clock::now())
+        {
+        }
+
+        scope_timer(const scope_timer&) = delete;
+        scope_timer& operator=(const scope_timer&) = delete;
+
+        ~scope_timer()
+        {
+            auto end = std::chrono::steady_clock::now();
+
+            auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin_);
+
+            histogram_.record(
+                static_cast<std::uint64_t>(std::max<std::int64_t>(duration.count(), 0)));
+
+            detail::timer_thread_state::instance().maybe_report(end);
+        }
+
+    private:
+        detail::timer_histogram& histogram_;
+        std::chrono::steady_clock::time_point begin_;
+    };
+} // namespace log
+} // namespace nitro
+
+#endif // INCLUDE_NITRO_LOG_SCOPE_TIMER_HPP
@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2026, Technische Universität Dresden, Germany
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted
+ * provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+ *    and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to
+ *    endorse or promote products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ * WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef INCLUDE_NITRO_LOG_SHM_COLLECTOR_HPP
+#define INCLUDE_NITRO_LOG_SHM_COLLECTOR_HPP
+
+#include <nitro/log/sink/shared_memory.hpp>
+
+#include <nitro/except/raise.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <thread>
+
+namespace nitro
+{
+namespace log
+{
+    /**
+     * @brief Drains the shared memory ring of sink::SharedMemory into a single file.
+     *
+     * There must be only one collector per ring. It may be started before or after the
+     * producers and appends to the file, so a restarted collector continues where the previous
+     * one stopped. Slots of producers, which died while writing a record, are skipped after
+     * stale_timeout() and counted in lost().
+     */
+    class shm_collector
+    {
+    public:
+        shm_collector(const std::string& segment_name, const std::string& file_name,
+                      std::uint32_t slot_count = sink::SharedMemory::slot_count())
+        : ring_(segment_name, slot_count), file_(file_name, std::ios::app)
+        {
+            if (!file_)
+            {
+                raise("Failed to open log file for shared memory collector: ", file_name);
+            }
+        }
+
+        /**
+         * @brief Writes all complete records in the ring to the file with one write call and
+         * returns their number.
+         */
+        std::size_t drain()
+        {
+            buffer_.clear();
+
+            auto records = ring_.drain([this](const std::string& record) { buffer_ += record; },
+                                       stale_timeout_);
+
+            if (!buffer_.empty())
+            {
+                file_.write(buffer_.data(), static_cast<std::streamsize>(buffer_.size()));
+                file_.flush();
+            }
+
+            return records;
+        }
+
+        /**
+         * @brief Drains the ring until stop is set, sleeping for poll_interval whenever it was
+         * empty. Drains the ring a last time before returning.
+         */
+        void run(const std::atomic<bool>& stop,
+                 std::chrono::milliseconds poll_interval = std::chrono::milliseconds(10))
+        {
+            while (!stop.load(std::memory_order_relaxed))
+            {
+                if (drain() == 0)
+                {
+                    std::this_thread::sleep_for(poll_interval);
+                }
+            }
+
+            drain();
+        }
+
+        std::chrono::steady_clock::duration& stale_timeout()
+        {
+            return stale_timeout_;
+        }
+
+        // records, which producers dropped, because the ring was full
+        std::uint64_t dropped() const
+        {
+            return ring_.dropped();
+        }
+
+        // slots, which were skipped, because their producer died while writing them
+        std::uint64_t lost() const
+        {
+            return ring_.lost();
+        }
+
+        static void remove(const std::string& segment_name)
+        {
+            detail::shm_ring::remove(segment_name);
+        }
+
+    private:
+        detail::shm_ring ring_;
+        std::ofstream file_;
+        std::string buffer_;
+        std::chrono::steady_clock::duration stale_timeout_ = std::chrono::seconds(1);
+    };
+} // namespace log
+} // namespace nitro
+
+#endif // INCLUDE_NITRO_LOG_SHM_COLLECTOR_HPP
@@ -0,0 +1,264 @@
+/*
+ * Copyright (c) 2026, Technische Universität Dresden, Germany
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted
+ * provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+ *    and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to
+ *    endorse or promote products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ * WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef INCLUDE_NITRO_LOG_SINK_AGGREGATE_HPP
+#define INCLUDE_NITRO_LOG_SINK_AGGREGATE_HPP
+
+#include <nitro/log/severity.hpp>
+#include <nitro/log/timestamp_parser.hpp>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace nitro
+{
+namespace log
+{
+    namespace sink
+    {
+        /**
+         * @brief Sink aggregating records with the same pattern per time window and passing one
+         * summary per group to another sink.
+         *
+         * The pattern of a record is its severity and its formatted text with every run of
+         * digits replaced, so it contains the tag and the message template, but not the values,
+         * e.g. timestamps or counts. At the end of every window, records, which occurred only
+         * once, are passed on unchanged. For all other groups the first record is passed on with
+         * " [count=N first=T last=T]" appended, where the timestamps are parsed by
+         * timestamp_parser(). Groups are emitted in the order of their first record. If a
+         * window has max_groups() groups already, records of new groups are passed on directly.
+         */
+        template <typename Sink>
+        class aggregate
+        {
+            struct group
+            {
+                severity_level severity;
+                std::string first_record;
+                std::uint64_t count;
+                std::int64_t first_timestamp;
+                std::int64_t last_timestamp;
+                bool has_timestamp;
+            };
+
+        public:
+            static std::chrono::milliseconds& default_interval()
+            {
+                static std::chrono::milliseconds interval(1000);
+                return interval;
+            }
+
+            static std::size_t& max_groups()
+            {
+                static std::size_t groups = 1024;
+                return groups;
+            }
+
+            static std::function<bool(const char*, std::size_t, std::int64_t&)>& timestamp_parser()
+            {
+                static std::function<bool(const char*, std::size_t, std::int64_t&)> parser =
+                    leading_timestamp;
+                return parser;
+            }
+
+            explicit aggregate(std::chrono::milliseconds interval = default_interval())
+            : interval_(interval), worker_([this]() { run(); })
+            {
+            }
+
+            aggregate(const aggregate&) = delete;
+            aggregate& operator=(const aggregate&) = delete;
+
+            ~aggregate()
+            {
+                {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    stop_ = true;
+                }
+
+                cv_.notify_one();
+                worker_.join();
+
+                flush();
+            }
+
+            void sink(severity_level sev, const std::string& formatted_record)
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+
+                pattern(sev, formatted_record, key_);
+
+                std::int64_t timestamp = 0;
+                bool has_timestamp =
+                    timestamp_parser() && timestamp_parser()(formatted_record.data(),
+                                                             formatted_record.size(), timestamp);
+
+                auto it = index_.find(key_);
+
+                if (it != index_.end())
+                {
+                    auto& g = groups_[it->second];
+
+                    ++g.count;
+
+                    if (has_timestamp)
+                    {
+                        if (!g.has_timestamp)
+                        {
+                            g.first_timestamp = timestamp;
+                            g.has_timestamp = true;
+                        }
+
+                        g.last_timestamp = timestamp;
+                    }
+
+                    return;
+                }
+
+                if (groups_.size() >= max_groups())
+                {
+                    sink_.sink(sev, formatted_record);
+                    return;
+                }
+
+                index_.emplace(key_, groups_.size());
+                groups_.push_back(
+                    { sev, formatted_record, 1, timestamp, timestamp, has_timestamp });
+            }
+
+            // emits the summaries of the current window and starts a new one
+            void flush()
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                emit();
+            }
+
+            Sink& wrapped_sink()
+            {
+                return sink_;
+            }
+
+        private:
+            // requires mutex_ to be locked
+            void emit()
+            {
+                std::string summary;
+
+                for (auto& g : groups_)
+                {
+                    if (g.count == 1)
+                    {
+                        sink_.sink(g.severity, g.first_record);
+                        continue;
+                    }
+
+                    summary = g.first_record;
+
+                    bool newline = !summary.empty() && summary.back() == '\n';
+                    if (newline)
+                    {
+                        summary.pop_back();
+                    }
+
+                    summary += " [count=" + std::to_string(g.count);
+
+                    if (g.has_timestamp)
+                    {
+                        summary += " first=" + std::to_string(g.first_timestamp) +
+                                   " last=" + std::to_string(g.last_timestamp);
+                    }
+
+                    summary += newline ? "]\n" : "]";
+
+                    sink_.sink(g.severity, summary);
+                }
+
+                groups_.clear();
+                index_.clear();
+            }
+
+            static void pattern(severity_level sev, const std::string& record, std::string& key)
+            {
+                key.assign(1, static_cast<char>('0' + static_cast<int>(sev)));
+
+                bool digits = false;
+
+                for (auto c : record)
+                {
+                    if (c >= '0' && c <= '9')
+                    {
+                        if (!digits)
+                        {
+                            key += '#';
+                            digits = true;
+                        }
+                    }
+                    else
+                    {
+                        key += c;
+                        digits = false;
+                    }
+                }
+            }
+
+            void run()
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+
+                while (!cv_.wait_for(lock, interval_, [this]() { return stop_; }))
+                {
+                    emit();
+                }
+            }
+
+        private:
+            Sink sink_;
+            std::chrono::milliseconds interval_;
+
+            std::mutex mutex_;
+            std::condition_variable cv_;
+            bool stop_ = false;
+
+            std::vector<group> groups_;
+            std::unordered_map<std::string, std::size_t> index_;
+            std::string key_;
+
+            std::thread worker_;
+        };
+    } // namespace sink
+} // namespace log
+} // namespace nitro
+
+#endif // INCLUDE_NITRO_LOG_SINK_AGGREGATE_HPP
@@ -0,0 +1,298 @@
+/*
+ * Copyright (c) 2026, Technische Universität Dresden, Germany
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted
+ * provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+ *    and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to
+ *    endorse or promote products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ * WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef INCLUDE_NITRO_LOG_SINK_ASYNC_HPP
+#define INCLUDE_NITRO_LOG_SINK_ASYNC_HPP
+
+#include <nitro/log/severity.hpp>
+#include <nitro/log/stats.hpp>
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+
+namespace nitro
+{
+namespace log
+{
+    namespace sink
+    {
+        namespace backpressure
+        {
+            enum class action
+            {
+                wait,
+                drop_newest,
+                drop_oldest
+            };
+
+            // the producer waits until there is space in the queue
+            struct block
+            {
+                static constexpr action on_full(severity_level)
+                {
+                    return action::wait;
+                }
+            };
+
+            // the record, which does not fit into the queue anymore, is dropped
+            struct drop_newest
+            {
+                static constexpr action on_full(severity_level)
+                {
+                    return action::drop_newest;
+                }
+            };
+
+            // the oldest queued record is dropped to make space
+            struct drop_oldest
+            {
+                static constexpr action on_full(severity_level)
+                {
+                    return action::drop_oldest;
+                }
+            };
+
+            // records below Min are dropped, all others wait for space
+            template <severity_level Min = severity_level::error>
+            struct drop_below
+            {
+                static_assert(Min <= severity_level::error,
+                              "error and fatal records must never be dropped");
+
+                static constexpr action on_full(severity_level sev)
+                {
+                    return sev < Min ? action::drop_newest : action::wait;
+                }
+            };
+        } // namespace backpressure
+
+        /**
+         * @brief Sink passing records to another sink on a thread of its own.
+         *
+         * The producer only appends to a bounded queue. If the queue is full, the Policy from
+         * the backpressure namespace decides, whether to wait or which record to drop. Dropped
+         * records are counted per severity. Once the queue has space again, a record reporting
+         * the number of records dropped since is inserted at the position of the loss. If no
+         * further record arrives, the worker thread passes the report on by itself, which also
+         * happens on flush() and before the sink is destroyed.
+         */
+        template <typename Sink, typename Policy = backpressure::block>
+        class async
+        {
+            using entry = std::pair<severity_level, std::string>;
+
+        public:
+            static std::size_t& default_capacity()
+            {
+                static std::size_t capacity = 8192;
+                return capacity;
+            }
+
+            explicit async(std::size_t capacity = default_capacity())
+            : capacity_(capacity < 2 ? 2 : capacity), worker_([this]() { run(); })
+            {
+            }
+
+            async(const async&) = delete;
+            async& operator=(const async&) = delete;
+
+            ~async()
+            {
+                {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    stop_ = true;
+                }
+
+                not_empty_.notify_one();
+                worker_.join();
+            }
+
+            void sink(severity_level sev, const std::string& formatted_record)
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+
+                while (queue_.size() >= capacity_)
+                {
+                    switch (Policy::on_full(sev))
+                    {
+                    case backpressure::action::wait:
+                        not_full_.wait(lock, [this]() { return queue_.size() < capacity_; });
+                        break;
+
+                    case backpressure::action::drop_newest:
+                        drop(sev);
+                        return;
+
+                    case backpressure::action::drop_oldest:
+                        drop(queue_.front().first);
+                        queue_.pop_front();
+                        break;
+                    }
+                }
+
+                // the pressure cleared, if the report and the record fit in
+                if (pending_drops_ > 0 && queue_.size() + 2 <= capacity_)
+                {
+                    report_drops(queue_);
+                }
+
+                queue_.emplace_back(sev, formatted_record);
+                detail::stats_queue_depth(queue_.size());
+
+                lock.unlock();
+                not_empty_.notify_one();
+            }
+
+            // waits until all records queued so far are passed to the sink
+            void flush()
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+
+                // including the report of pending drops
+                auto target = enqueued_ + queue_.size() + (pending_drops_ > 0 ? 1 : 0);
+
+                not_empty_.notify_one();
+                drained_.wait(lock, [this, target]() { return processed_ >= target; });
+            }
+
+            std::uint64_t dropped(severity_level sev) const
+            {
+                return dropped_[static_cast<std::size_t>(sev)].load(std::memory_order_relaxed);
+            }
+
+            std::uint64_t dropped() const
+            {
+                std::uint64_t sum = 0;
+                for (auto& count : dropped_)
+                {
+                    sum += count.load(std::memory_order_relaxed);
+                }
+                return sum;
+            }
+
+            Sink& wrapped_sink()
+            {
+                return sink_;
+            }
+
+        private:
+            // requires mutex_ to be locked
+            void drop(severity_level sev)
+            {
+                dropped_[static_cast<std::size_t>(sev)].fetch_add(1, std::memory_order_relaxed);
+                ++pending_drops_;
+                ++enqueued_;
+                ++processed_;
+
+                detail::stats_dropped(1);
+            }
+
+            // requires mutex_ to be locked
+            void report_drops(std::deque<entry>& queue)
+            {
+                queue.emplace_back(severity_level::warn, "nitro::log: " +
+                                                             std::to_string(pending_drops_) +
+                                                             " records dropped\n");
+                pending_drops_ = 0;
+            }
+
+            void run()
+            {
+                std::deque<entry> batch;
+                std::unique_lock<std::mutex> lock(mutex_);
+
+                while (true)
+                {
+                    not_empty_.wait(lock, [this]() {
+                        return stop_ || !queue_.empty() || pending_drops_ > 0;
+                    });
+
+                    if (queue_.empty() && pending_drops_ == 0)
+                    {
+                        return;
+                    }
+
+                    batch.swap(queue_);
+
+                    // the drops happened after everything in the queue
+                    if (pending_drops_ > 0)
+                    {
+                        report_drops(batch);
+                    }
+
+                    enqueued_ += batch.size();
+
+                    lock.unlock();
+                    not_full_.notify_all();
+
+                    for (auto& e : batch)
+                    {
+                        sink_.sink(e.first, e.second);
+                    }
+
+                    lock.lock();
+
+                    processed_ += batch.size();
+                    batch.clear();
+
+                    drained_.notify_all();
+                }
+            }
+
+        private:
+            Sink sink_;
+            std::size_t capacity_;
+
+            std::mutex mutex_;
+            std::condition_variable not_empty_;
+            std::condition_variable not_full_;
+            std::condition_variable drained_;
+            std::deque<entry> queue_;
+            bool stop_ = false;
+
+            // records taken from the queue by the worker or dropped, and those fully processed
+            std::uint64_t enqueued_ = 0;
+            std::uint64_t processed_ = 0;
+
+            std::uint64_t pending_drops_ = 0;
+            std::array<std::atomic<std::uint64_t>, 6> dropped_{};
+
+            std::thread worker_;
+        };
+    } // namespace sink
+} // namespace log
+} // namespace nitro
+
+#endif // INCLUDE_NITRO_LOG_SINK_ASYNC_HPP
@@ -0,0 +1,319 @@
+/*
+ * Copyright (c) 2026, Technische Universität Dresden, Germany
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted
+ * provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+ *    and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to
+ *    endorse or promote products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ * WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef INCLUDE_NITRO_LOG_SINK_COMPRESSED_LOGFILE_HPP
+#define INCLUDE_NITRO_LOG_SINK_COMPRESSED_LOGFILE_HPP
+
+#include <nitro/log/detail/crc32c.hpp>
+#include <nitro/log/detail/lz4_block.hpp>
+#include <nitro/log/severity.hpp>
+#include <nitro/log/timestamp_parser.hpp>
+
+#include <nitro/except/raise.hpp>
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace nitro
+{
+namespace log
+{
+    struct compressed_log_header
+    {
+        // including the terminating null character
+        static const char* magic_value()
+        {
+            return "NLOGLZ4";
+        }
+
+        static constexpr std::uint32_t version_value = 1;
+
+        char magic[8];
+        std::uint32_t version;
+        std::uint32_t chunk_header_size;
+    };
+
+    /**
+     * @brief Header in front of every chunk of a compressed log file.
+     */
+    struct compressed_chunk_header
+    {
+        static constexpr std::uint32_t magic_value = 0x4b48434e; // "NCHK"
+        static constexpr std::uint32_t compressed = 1;
+
+        std::uint32_t magic;
+        std::uint32_t flags;
+        // size of the chunk data following the header
+        std::uint32_t stored_size;
+        std::uint32_t size;
+        std::uint32_t records;
+        // CRC-32C of the uncompressed data
+        std::uint32_t crc;
+        std::int64_t first_timestamp;
+        std::int64_t last_timestamp;
+    };
+
+    static_assert(sizeof(compressed_chunk_header) == 40,
+                  "Unexpected padding in compressed_chunk_header");
+
+    namespace sink
+    {
+        /**
+         * @brief Logfile sink writing independently compressed chunks of records.
+         *
+         * Records are collected until the chunk reaches chunk_size(). Full chunks are compressed
+         * in the LZ4 block format and written by a worker thread. Every chunk header contains
+         * the time range of the chunk as parsed by timestamp_parser() and a checksum, so chunks
+         * can be located and decompressed independently. See compressed_log_reader in
+         * <nitro/log/compressed_reader.hpp>.
+         */
+        class CompressedLogfile
+        {
+            struct chunk
+            {
+                std::string data;
+                std::uint32_t records = 0;
+                std::int64_t first_timestamp = std::numeric_limits<std::int64_t>::max();
+                std::int64_t last_timestamp = std::numeric_limits<std::int64_t>::min();
+            };
+
+        public:
+            static std::string& log_file()
+            {
+                static std::string file_name("log.nlz");
+                return file_name;
+            }
+
+            static std::size_t& chunk_size()
+            {
+                static std::size_t size = 1024 * 1024;
+                return size;
+            }
+
+            static std::function<bool(const char*, std::size_t, std::int64_t&)>& timestamp_parser()
+            {
+                static std::function<bool(const char*, std::size_t, std::int64_t&)> parser =
+                    leading_timestamp;
+                return parser;
+            }
+
+            CompressedLogfile() : out_(log_file(), std::ios::binary)
+            {
+                if (!out_)
+                {
+                    raise("Cannot open log file: ", log_file());
+                }
+
+                compressed_log_header header;
+                std::memcpy(header.magic, compressed_log_header::magic_value(),
+                            sizeof(header.magic));
+                header.version = compressed_log_header::version_value;
+                header.chunk_header_size = sizeof(compressed_chunk_header);
+
+                out_.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+                chunk_.data.reserve(chunk_size());
+                worker_ = std::thread([this]() { run(); });
+            }
+
+            CompressedLogfile(const CompressedLogfile&) = delete;
+            CompressedLogfile& operator=(const CompressedLogfile&) = delete;
+
+            ~CompressedLogfile()
+            {
+                {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    seal();
+                    stop_ = true;
+                }
+
+                not_empty_.notify_one();
+                worker_.join();
+            }
+
+            void sink(severity_level, const std::string& formatted_record)
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+
+                std::int64_t timestamp;
+                if (timestamp_parser() &&
+                    timestamp_parser()(formatted_record.data(), formatted_record.size(), timestamp))
+                {
+                    chunk_.first_timestamp = std::min(chunk_.first_timestamp, timestamp);
+                    chunk_.last_timestamp = std::max(chunk_.last_timestamp, timestamp);
+                }
+
+                chunk_.data += formatted_record;
+                ++chunk_.records;
+
+                if (chunk_.data.size() >= chunk_size())
+                {
+                    // bounds the memory, if the worker cannot keep up
+                    not_full_.wait(lock, [this]() { return queue_.size() < max_queued; });
+
+                    seal();
+
+                    lock.unlock();
+                    not_empty_.notify_one();
+                }
+            }
+
+            // writes the current chunk, even if it is not full yet, and waits until it is written
+            void flush()
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+
+                seal();
+                not_empty_.notify_one();
+
+                auto target = sealed_;
+                drained_.wait(lock, [this, target]() { return written_ >= target; });
+            }
+
+        private:
+            static constexpr std::size_t max_queued = 4;
+
+            // requires mutex_ to be locked
+            void seal()
+            {
+                if (chunk_.records == 0)
+                {
+                    return;
+                }
+
+                queue_.emplace_back(std::move(chunk_));
+                chunk_ = chunk();
+                chunk_.data.reserve(chunk_size());
+
+                ++sealed_;
+            }
+
+            void run()
+            {
+                detail::lz4_block codec;
+                std::string compressed;
+
+                std::unique_lock<std::mutex> lock(mutex_);
+
+                while (true)
+                {
+                    not_empty_.wait(lock, [this]() { return stop_ || !queue_.empty(); });
+
+                    if (queue_.empty())
+                    {
+                        return;
+                    }
+
+                    auto current = std::move(queue_.front());
+                    queue_.pop_front();
+
+                    lock.unlock();
+                    not_full_.notify_one();
+
+                    write(codec, compressed, current);
+
+                    lock.lock();
+
+                    ++written_;
+                    drained_.notify_all();
+                }
+            }
+
+            void write(detail::lz4_block& codec, std::string& compressed, const chunk& c)
+            {
+                compressed_chunk_header header;
+                header.magic = compressed_chunk_header::magic_value;
+                header.size = static_cast<std::uint32_t>(c.data.size());
+                header.records = c.records;
+                header.crc = detail::crc32c(c.data.data(), c.data.size());
+
+                if (c.first_timestamp <= c.last_timestamp)
+                {
+                    header.first_timestamp = c.first_timestamp;
+                    header.last_timestamp = c.last_timestamp;
+                }
+                else
+                {
+                    // cannot be skipped by time
+                    header.first_timestamp = std::numeric_limits<std::int64_t>::min();
+                    header.last_timestamp = std::numeric_limits<std::int64_t>::max();
+                }
+
+                compressed.resize(detail::lz4_block::bound(c.data.size()));
+                auto size = codec.compress(c.data.data(), c.data.size(), &compressed[0]);
+
+                const char* payload = compressed.data();
+
+                if (size < c.data.size())
+                {
+                    header.flags = compressed_chunk_header::compressed;
+                    header.stored_size = static_cast<std::uint32_t>(size);
+                }
+                else
+                {
+                    // incompressible data is stored as is
+                    header.flags = 0;
+                    header.stored_size = header.size;
+                    payload = c.data.data();
+                }
+
+                out_.write(reinterpret_cast<const char*>(&header), sizeof(header));
+                out_.write(payload, header.stored_size);
+                out_.flush();
+            }
+
+        private:
+            std::ofstream out_;
+
+            std::mutex mutex_;
+            std::condition_variable not_empty_;
+            std::condition_variable not_full_;
+            std::condition_variable drained_;
+            chunk chunk_;
+            std::deque<chunk> queue_;
+            bool stop_ = false;
+
+            std::uint64_t sealed_ = 0;
+            std::uint64_t written_ = 0;
+
+            std::thread worker_;
+        };
+    } // namespace sink
+} // namespace log
+} // namespace nitro
+
+#endif // INCLUDE_NITRO_LOG_SINK_COMPRESSED_LOGFILE_HPP
@@ -28,37 +28,164 @@
 
 #pragma once
 
+#include <nitro/log/index.hpp>
 #include <nitro/log/severity.hpp>
 
+#include <cstdint>
 #include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <utility>
 
 namespace nitro
 {
 namespace log
 {
+    namespace detail
+    {
+        struct logfile_state
+        {
+            logfile_state(const std::string& file_name, bool append)
+            : file_name(file_name), initial_size(append ? file_size(file_name) : 0),
+              stream(file_name, append ? std::ios_base::out | std::ios_base::app :
+                                         std::ios_base::out)
+            {
+            }
+
+            static std::uint64_t file_size(const std::string& file_name)
+            {
+                std::ifstream file(file_name, std::ios_base::binary | std::ios_base::ate);
+                return file ? static_cast<std::uint64_t>(file.tellg()) : 0;
+            }
+
+            std::string file_name;
+            // the size of the file before this stream wrote to it, where the index continues
+            std::uint64_t initial_size;
+            std::ofstream stream;
+            std::unique_ptr<log_index_writer> index;
+        };
+
+        // all Logfile sinks writing to the same file share its stream. A file is truncated when
+        // it is opened for the first time and appended to when it is opened again later.
+        inline std::shared_ptr<logfile_state> open_logfile(const std::string& file_name)
+        {
+            static std::mutex mutex;
+            static std::map<std::string, std::weak_ptr<logfile_state>> files;
+
+            std::lock_guard<std::mutex> lock(mutex);
+
+            auto it = files.find(file_name);
+
+            if (it == files.end())
+            {
+                auto state = std::make_shared<logfile_state>(file_name, false);
+                files.emplace(file_name, state);
+                return state;
+            }
+
+            auto state = it->second.lock();
+
+            if (!state)
+            {
+                state = std::make_shared<logfile_state>(file_name, true);
+                it->second = state;
+            }
+
+            return state;
+        }
+
+        inline log_index_writer& logfile_index(logfile_state& state,
+                                               const log_index_options& options)
+        {
+            if (!state.index)
+            {
+                state.index.reset(
+                    new log_index_writer(state.file_name + ".idx", options, state.initial_size));
+            }
+
+            return *state.index;
+        }
+    } // namespace detail
+
     namespace sink
     {
         class Logfile
         {
 
         public:
+            // the file name of default constructed instances, read when they open the file
             static std::string& log_file()
             {
                 static std::string file_name("log.txt");
                 return file_name;
             }
 
+            // the stream of log_file()
             static std::ofstream& log_stream()
             {
-                static std::ofstream of(log_file());
-                return of;
+                return default_file().stream;
             }
 
-            void sink(severity_level, const std::string& formatted_record)
+            // set enabled before the first record is logged to write the file name + ".idx"
+            static log_index_options& index_options()
             {
-                log_stream() << formatted_record << std::flush;
+                static log_index_options options;
+                return options;
             }
+
+            // the index writer of log_file()
+            static detail::log_index_writer& index_writer()
+            {
+                return detail::logfile_index(default_file(), index_options());
+            }
+
+            Logfile() = default;
+
+            // instances with the same file name write into the same stream
+            explicit Logfile(std::string file_name) : file_name_(std::move(file_name))
+            {
+            }
+
+            std::ofstream& stream()
+            {
+                return file().stream;
+            }
+
+            void sink(severity_level sev, const std::string& formatted_record)
+            {
+                auto& f = file();
+
+                f.stream << formatted_record << std::flush;
+
+                if (index_options().enabled)
+                {
+                    detail::logfile_index(f, index_options()).add(sev, formatted_record);
+                }
+            }
+
+        private:
+            static detail::logfile_state& default_file()
+            {
+                static std::shared_ptr<detail::logfile_state> state =
+                    detail::open_logfile(log_file());
+                return *state;
+            }
+
+            detail::logfile_state& file()
+            {
+                if (!file_)
+                {
+                    file_ = detail::open_logfile(file_name_.empty() ? log_file() : file_name_);
+                }
+
+                return *file_;
+            }
+
+        private:
+            std::string file_name_;
+            std::shared_ptr<detail::logfile_state> file_;
         };
 
     } // namespace sink
@@ -0,0 +1,468 @@
+/*
+ * Copyright (c) 2026, Technische Universität Dresden, Germany
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted
+ * provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+ *    and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to
+ *    endorse or promote products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ * WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef INCLUDE_NITRO_LOG_SINK_MPI_GATHER_HPP
+#define INCLUDE_NITRO_LOG_SINK_MPI_GATHER_HPP
+
+#include <nitro/log/severity.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <iostream>
+#include <limits>
+#include <list>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <mpi.h>
+
+namespace nitro
+{
+namespace log
+{
+    namespace sink
+    {
+        /**
+         * @brief Sink collecting the records of all MPI ranks on a single writer rank.
+         *
+         * Every rank buffers its records together with the time they arrived at the sink. Once
+         * a batch is full or the interval elapsed, it is shipped to the writer rank with a
+         * non-blocking send. The writer receives batches whenever it logs or flush() is called
+         * and writes all records to stdout ordered by time. Records are only written once every
+         * rank shipped a batch which is newer, so calling flush() periodically on ranks, which
+         * rarely log, keeps the output flowing.
+         *
+         * The remaining records are gathered when MPI_Finalize() is called or the sink is
+         * destroyed before, which has to happen on all ranks. For that, the writer waits for
+         * every rank, so the sink has to take part on all of them, even if they never log. A sink
+         * constructed after MPI_Init() takes part right away, one constructed before, e.g. by an
+         * early log record, once it logs or flush() is called after MPI_Init(). Before MPI_Init()
+         * and after MPI_Finalize(), records are written to stdout directly. Records are
+         * timestamped with the system clock, so ordering across nodes is only as good as their
+         * clock sync.
+         */
+        class MpiGather
+        {
+            using clock = std::chrono::system_clock;
+
+            struct batch_header
+            {
+                std::int64_t shipped_at;
+                std::int32_t last;
+            };
+
+            struct entry_header
+            {
+                std::int64_t timestamp;
+                std::uint32_t size;
+            };
+
+            struct entry
+            {
+                std::int64_t timestamp;
+                std::string text;
+            };
+
+            struct send_op
+            {
+                std::string data;
+                MPI_Request request;
+            };
+
+        public:
+            static int& writer_rank()
+            {
+                static int rank = 0;
+                return rank;
+            }
+
+            static std::size_t& batch_size()
+            {
+                static std::size_t size = 64 * 1024;
+                return size;
+            }
+
+            static std::chrono::milliseconds& interval()
+            {
+                static std::chrono::milliseconds interval(1000);
+                return interval;
+            }
+
+            // the writer writes records out of order, rather than keeping more bytes than this
+            static std::size_t& max_pending()
+            {
+                static std::size_t size = 64 * 1024 * 1024;
+                return size;
+            }
+
+            static int& mpi_tag()
+            {
+                static int tag = 32000;
+                return tag;
+            }
+
+            MpiGather()
+            {
+                reset_batch();
+
+                // takes part in the final gathering, even if this rank never logs
+                std::lock_guard<std::mutex> lock(mutex_);
+                ready();
+            }
+
+            MpiGather(const MpiGather&) = delete;
+            MpiGather& operator=(const MpiGather&) = delete;
+
+            ~MpiGather()
+            {
+                {
+                    // a sink constructed before MPI_Init() still has to take part
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    ready();
+                }
+
+                int finalized = 0;
+                MPI_Finalized(&finalized);
+
+                if (initialized_ && !finalized)
+                {
+                    // invokes finish() via the attribute delete callback
+                    MPI_Comm_delete_attr(MPI_COMM_SELF, keyval_);
+                    MPI_Comm_free_keyval(&keyval_);
+                }
+            }
+
+            void sink(severity_level, const std::string& formatted_record)
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+
+                if (!ready())
+                {
+                    write(formatted_record);
+                    return;
+                }
+
+                auto now = timestamp();
+
+                if (rank_ == writer_rank())
+                {
+                    pending_[rank_].push_back({ now, formatted_record });
+                    pending_bytes_ += formatted_record.size();
+                    local_bytes_ += formatted_record.size();
+
+                    if (local_bytes_ >= batch_size() || now - last_ship_ >= interval_ns())
+                    {
+                        drain(now);
+                    }
+                }
+                else
+                {
+                    entry_header header{ now, static_cast<std::uint32_t>(formatted_record.size()) };
+                    batch_.append(reinterpret_cast<const char*>(&header), sizeof(header));
+                    batch_.append(formatted_record);
+
+                    if (batch_.size() >= batch_size() || now - last_ship_ >= interval_ns())
+                    {
+                        ship(now, false);
+                    }
+                }
+            }
+
+            void flush()
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+
+                if (!ready())
+                {
+                    return;
+                }
+
+                if (rank_ == writer_rank())
+                {
+                    drain(timestamp());
+                }
+                else
+                {
+                    ship(timestamp(), false);
+                }
+            }
+
+        private:
+            static std::int64_t timestamp()
+            {
+                return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                           clock::now().time_since_epoch())
+                    .count();
+            }
+
+            static std::int64_t interval_ns()
+            {
+                return std::chrono::duration_cast<std::chrono::nanoseconds>(interval()).count();
+            }
+
+            static void write(const std::string& data)
+            {
+                std::cout.write(data.data(), static_cast<std::streamsize>(data.size()));
+                std::cout.flush();
+            }
+
+            static int on_finalize(MPI_Comm, int, void* sink, void*)
+            {
+                static_cast<MpiGather*>(sink)->finish();
+                return MPI_SUCCESS;
+            }
+
+            // requires mutex_ to be locked
+            bool ready()
+            {
+                if (initialized_ || finished_)
+                {
+                    return !finished_;
+                }
+
+                int initialized = 0;
+                int finalized = 0;
+                MPI_Initialized(&initialized);
+                MPI_Finalized(&finalized);
+
+                if (!initialized || finalized)
+                {
+                    return false;
+                }
+
+                MPI_Comm_rank(MPI_COMM_WORLD, &rank_);
+                MPI_Comm_size(MPI_COMM_WORLD, &size_);
+
+                pending_.resize(size_);
+                watermark_.assign(size_, std::numeric_limits<std::int64_t>::min());
+                last_ship_ = timestamp();
+
+                MPI_Comm_create_keyval(MPI_COMM_NULL_COPY_FN, &MpiGather::on_finalize, &keyval_,
+                                       nullptr);
+                MPI_Comm_set_attr(MPI_COMM_SELF, keyval_, this);
+
+                initialized_ = true;
+
+                return true;
+            }
+
+            void reset_batch()
+            {
+                batch_.assign(sizeof(batch_header), '\0');
+            }
+
+            // requires mutex_ to be locked
+            void ship(std::int64_t now, bool last)
+            {
+                batch_header header{ now, last };
+                std::memcpy(&batch_[0], &header, sizeof(header));
+
+                sends_.emplace_back();
+                auto& op = sends_.back();
+                op.data = std::move(batch_);
+
+                MPI_Isend(&op.data[0], static_cast<int>(op.data.size()), MPI_BYTE, writer_rank(),
+                          mpi_tag(), MPI_COMM_WORLD, &op.request);
+
+                reset_batch();
+                last_ship_ = now;
+
+                for (auto it = sends_.begin(); it != sends_.end();)
+                {
+                    int done = 0;
+                    MPI_Test(&it->request, &done, MPI_STATUS_IGNORE);
+
+                    it = done ? sends_.erase(it) : std::next(it);
+                }
+            }
+
+            // requires mutex_ to be locked
+            void receive(const MPI_Status& status)
+            {
+                int count = 0;
+                MPI_Get_count(&status, MPI_BYTE, &count);
+
+                std::string data(static_cast<std::size_t>(count), '\0');
+                MPI_Recv(&data[0], count, MPI_BYTE, status.MPI_SOURCE, mpi_tag(), MPI_COMM_WORLD,
+                         MPI_STATUS_IGNORE);
+
+                batch_header header;
+                std::memcpy(&header, data.data(), sizeof(header));
+
+                auto& pending = pending_[status.MPI_SOURCE];
+
+                for (std::size_t pos = sizeof(header); pos < data.size();)
+                {
+                    entry_header e;
+                    std::memcpy(&e, data.data() + pos, sizeof(e));
+                    pos += sizeof(e);
+
+                    pending.push_back({ e.timestamp, data.substr(pos, e.size) });
+                    pending_bytes_ += e.size;
+                    pos += e.size;
+                }
+
+                watermark_[status.MPI_SOURCE] =
+                    header.last ? std::numeric_limits<std::int64_t>::max() : header.shipped_at;
+            }
+
+            bool ended(int rank) const
+            {
+                return watermark_[rank] == std::numeric_limits<std::int64_t>::max();
+            }
+
+            // requires mutex_ to be locked
+            void drain(std::int64_t now)
+            {
+                while (true)
+                {
+                    int flag = 0;
+                    MPI_Status status;
+                    MPI_Iprobe(MPI_ANY_SOURCE, mpi_tag(), MPI_COMM_WORLD, &flag, &status);
+
+                    // a message from a rank, which already finished, belongs to another sink
+                    if (!flag || ended(status.MPI_SOURCE))
+                    {
+                        break;
+                    }
+
+                    receive(status);
+                }
+
+                watermark_[rank_] = now;
+                write_pending(*std::min_element(watermark_.begin(), watermark_.end()));
+
+                local_bytes_ = 0;
+                last_ship_ = now;
+            }
+
+            // writes all records up to the given time ordered by their timestamp
+            void write_pending(std::int64_t until)
+            {
+                if (pending_bytes_ > max_pending())
+                {
+                    until = std::numeric_limits<std::int64_t>::max();
+                }
+
+                std::vector<entry> ready;
+
+                for (auto& pending : pending_)
+                {
+                    while (!pending.empty() && pending.front().timestamp <= until)
+                    {
+                        pending_bytes_ -= pending.front().text.size();
+                        ready.emplace_back(std::move(pending.front()));
+                        pending.pop_front();
+                    }
+                }
+
+                if (ready.empty())
+                {
+                    return;
+                }
+
+                std::stable_sort(ready.begin(), ready.end(), [](const entry& a, const entry& b) {
+                    return a.timestamp < b.timestamp;
+                });
+
+                std::string out;
+                for (auto& e : ready)
+                {
+                    out += e.text;
+                }
+
+                write(out);
+            }
+
+            void finish()
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+
+                if (!initialized_ || finished_)
+                {
+                    return;
+                }
+
+                if (rank_ == writer_rank())
+                {
+                    for (int rank = 0; rank < size_; ++rank)
+                    {
+                        while (rank != rank_ && !ended(rank))
+                        {
+                            MPI_Status status;
+                            MPI_Probe(rank, mpi_tag(), MPI_COMM_WORLD, &status);
+
+                            receive(status);
+                        }
+                    }
+
+                    write_pending(std::numeric_limits<std::int64_t>::max());
+                }
+                else
+                {
+                    ship(timestamp(), true);
+
+                    for (auto& op : sends_)
+                    {
+                        MPI_Wait(&op.request, MPI_STATUS_IGNORE);
+                    }
+                    sends_.clear();
+                }
+
+                finished_ = true;
+            }
+
+        private:
+            std::mutex mutex_;
+
+            bool initialized_ = false;
+            bool finished_ = false;
+            int rank_ = -1;
+            int size_ = 0;
+            int keyval_ = MPI_KEYVAL_INVALID;
+            std::int64_t last_ship_ = 0;
+
+            // used on every rank but the writer
+            std::string batch_;
+            std::list<send_op> sends_;
+
+            // used on the writer rank only
+            std::vector<std::deque<entry>> pending_;
+            std::vector<std::int64_t> watermark_;
+            std::size_t pending_bytes_ = 0;
+            std::size_t local_bytes_ = 0;
+        };
+    } // namespace sink
+} // namespace log
+} // namespace nitro
+
+#endif // INCLUDE_NITRO_LOG_SINK_MPI_GATHER_HPP
@@ -0,0 +1,736 @@
+/*
+ * Copyright (c) 2026, Technische Universität Dresden, Germany
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted
+ * provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+ *    and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to
+ *    endorse or promote products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ * WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef INCLUDE_NITRO_LOG_SINK_NETWORK_HPP
+#define INCLUDE_NITRO_LOG_SINK_NETWORK_HPP
+
+#include <nitro/log/severity.hpp>
+#include <nitro/log/stats.hpp>
+
+#include <nitro/except/raise.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include <cerrno>
+
+extern "C"
+{
+#include <fcntl.h>
+#include <netdb.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+}
+
+namespace nitro
+{
+namespace log
+{
+    namespace sink
+    {
+        struct network_options
+        {
+            enum class protocol
+            {
+                tcp,
+                udp
+            };
+
+            std::string host = "127.0.0.1";
+            std::uint16_t port = 5140;
+            protocol transport = protocol::tcp;
+
+            // records are collected until a batch reaches this size and then written at once
+            std::size_t batch_size = 64 * 1024;
+            // partially filled batches are sent after this interval at the latest
+            std::chrono::milliseconds flush_interval = std::chrono::milliseconds(100);
+
+            // upper bound of batches kept in memory, further records are dropped
+            std::size_t memory_spool_size = 4 * 1024 * 1024;
+            // batches are moved to this file while the collector is unreachable, empty disables it
+            std::string spool_file;
+            std::size_t disk_spool_size = 256 * 1024 * 1024;
+
+            std::chrono::milliseconds min_backoff = std::chrono::milliseconds(100);
+            std::chrono::milliseconds max_backoff = std::chrono::milliseconds(10000);
+
+            // an attempt to connect is given up after this time, e.g. if the host does not answer
+            std::chrono::milliseconds connect_timeout = std::chrono::milliseconds(1000);
+        };
+
+        struct network_stats
+        {
+            std::uint64_t sent;
+            std::uint64_t sent_bytes;
+            std::uint64_t spooled;
+            std::uint64_t dropped;
+            // records cut to the batch size, as they would not fit into a datagram otherwise
+            std::uint64_t truncated;
+        };
+
+        /**
+         * @brief Sink shipping formatted records to a remote collector via TCP or UDP.
+         *
+         * Records are only appended to a batch on the calling thread. A background thread
+         * writes whole batches to the collector, reconnects with exponential backoff and moves
+         * batches into the spool file while the collector is unreachable. Spooled batches are
+         * replayed in order before any newer batch once the connection is back, including those
+         * left over by a previous process using the same spool file. A spool file, which is
+         * truncated or corrupt, is discarded from the first broken batch on. Delivery is at least
+         * once, as a batch, which failed halfway, is sent again completely. Connection attempts
+         * give up after connect_timeout, which also bounds the time the destructor waits for an
+         * unreachable host.
+         */
+        class Network
+        {
+            using clock = std::chrono::steady_clock;
+
+            struct batch
+            {
+                std::string data;
+                std::uint32_t records = 0;
+            };
+
+            struct spool_header
+            {
+                std::uint32_t size;
+                std::uint32_t records;
+            };
+
+            // the maximum payload of an UDP datagram
+            static constexpr std::size_t max_datagram_size = 65507;
+
+        public:
+            static network_options& options()
+            {
+                static network_options options_;
+                return options_;
+            }
+
+            Network() : Network(options())
+            {
+            }
+
+            explicit Network(network_options opts) : options_(std::move(opts))
+            {
+                if (options_.transport == network_options::protocol::udp)
+                {
+                    if (options_.batch_size > max_datagram_size)
+                    {
+                        options_.batch_size = max_datagram_size;
+                    }
+                }
+
+                current_.data.reserve(options_.batch_size);
+
+                if (!options_.spool_file.empty())
+                {
+                    open_spool();
+                }
+
+                worker_ = std::thread([this]() { run(); });
+            }
+
+            Network(const Network&) = delete;
+            Network& operator=(const Network&) = delete;
+
+            ~Network()
+            {
+                {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    stop_ = true;
+                }
+
+                cv_.notify_one();
+                worker_.join();
+
+                disconnect();
+
+                if (spool_fd_ != -1)
+                {
+                    ::close(spool_fd_);
+                }
+            }
+
+            void sink(severity_level, const std::string& formatted_record)
+            {
+                auto size = formatted_record.size();
+                bool truncate = options_.transport == network_options::protocol::udp &&
+                                size > options_.batch_size;
+
+                if (truncate)
+                {
+                    size = options_.batch_size;
+                    ++truncated_;
+                }
+
+                std::unique_lock<std::mutex> lock(mutex_);
+
+                if (!current_.data.empty() && current_.data.size() + size > options_.batch_size)
+                {
+                    seal_batch();
+                }
+
+                current_.data.append(formatted_record, 0, size);
+                ++current_.records;
+
+                if (truncate)
+                {
+                    current_.data.back() = '\n';
+                }
+
+                if (current_.data.size() >= options_.batch_size)
+                {
+                    seal_batch();
+
+                    lock.unlock();
+                    cv_.notify_one();
+                }
+            }
+
+            void flush()
+            {
+                {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    seal_batch();
+                }
+
+                cv_.notify_one();
+            }
+
+            network_stats stats() const
+            {
+                return { sent_.load(), sent_bytes_.load(), spooled_.load(), dropped_.load(),
+                         truncated_.load() };
+            }
+
+        private:
+            // requires mutex_ to be locked
+            void seal_batch()
+            {
+                if (current_.records == 0)
+                {
+                    return;
+                }
+
+                if (queued_bytes_ + current_.data.size() > options_.memory_spool_size)
+                {
+                    dropped_ += current_.records;
+                    detail::stats_dropped(current_.records);
+                    current_.data.clear();
+                    current_.records = 0;
+                    return;
+                }
+
+                queued_bytes_ += current_.data.size();
+                queue_.emplace_back(std::move(current_));
+
+                current_ = batch();
+                current_.data.reserve(options_.batch_size);
+            }
+
+            void run()
+            {
+                auto backoff = options_.min_backoff;
+                auto next_attempt = clock::now();
+
+                std::unique_lock<std::mutex> lock(mutex_);
+
+                while (true)
+                {
+                    auto deadline = clock::now() + options_.flush_interval;
+                    if (socket_ == -1)
+                    {
+                        deadline = std::min(deadline, std::max(next_attempt, clock::now()));
+                    }
+
+                    // while there is nowhere to put queued batches, only the deadline wakes us up
+                    bool can_drain = socket_ != -1 || (spool_fd_ != -1 && !spool_full_);
+
+                    bool woken = cv_.wait_until(lock, deadline, [this, can_drain]() {
+                        return stop_ || (can_drain && !queue_.empty());
+                    });
+
+                    bool stopping = stop_;
+
+                    if (!woken || stopping)
+                    {
+                        seal_batch();
+                    }
+
+                    lock.unlock();
+
+                    if (socket_ == -1 && (stopping || clock::now() >= next_attempt))
+                    {
+                        if (connect())
+                        {
+                            backoff = options_.min_backoff;
+                        }
+                        else
+                        {
+                            next_attempt = clock::now() + backoff;
+                            backoff = std::min(backoff * 2, options_.max_backoff);
+                        }
+                    }
+
+                    if (socket_ != -1)
+                    {
+                        replay_spool();
+                    }
+
+                    lock.lock();
+
+                    while (socket_ != -1 && spool_empty() && !queue_.empty())
+                    {
+                        batch b = take_front();
+
+                        lock.unlock();
+                        int error = send(b.data);
+                        lock.lock();
+
+                        if (error == 0)
+                        {
+                            sent_ += b.records;
+                            sent_bytes_ += b.data.size();
+                        }
+                        else if (is_permanent(error))
+                        {
+                            // sending it again would fail again
+                            dropped_ += b.records;
+                            detail::stats_dropped(b.records);
+                        }
+                        else
+                        {
+                            disconnect();
+                            next_attempt = clock::now();
+
+                            queued_bytes_ += b.data.size();
+                            queue_.emplace_front(std::move(b));
+                        }
+                    }
+
+                    if (socket_ == -1 || !spool_empty())
+                    {
+                        spill(lock);
+                    }
+
+                    if (stopping)
+                    {
+                        for (auto& b : queue_)
+                        {
+                            dropped_ += b.records;
+                            detail::stats_dropped(b.records);
+                        }
+                        queue_.clear();
+                        queued_bytes_ = 0;
+
+                        return;
+                    }
+                }
+            }
+
+            // requires mutex_ to be locked
+            batch take_front()
+            {
+                batch b = std::move(queue_.front());
+                queue_.pop_front();
+                queued_bytes_ -= b.data.size();
+
+                return b;
+            }
+
+            // moves all queued batches into the spool file, as long as it has space left
+            void spill(std::unique_lock<std::mutex>& lock)
+            {
+                if (spool_fd_ == -1)
+                {
+                    return;
+                }
+
+                while (!queue_.empty())
+                {
+                    if (spool_size_ + sizeof(spool_header) + queue_.front().data.size() >
+                        options_.disk_spool_size)
+                    {
+                        spool_full_ = true;
+                        return;
+                    }
+
+                    batch b = take_front();
+
+                    lock.unlock();
+                    bool success = append_spool(b);
+                    lock.lock();
+
+                    if (success)
+                    {
+                        spooled_ += b.records;
+                    }
+                    else
+                    {
+                        spool_full_ = true;
+
+                        queued_bytes_ += b.data.size();
+                        queue_.emplace_front(std::move(b));
+                        return;
+                    }
+                }
+            }
+
+            bool spool_empty() const
+            {
+                return spool_offset_ == spool_size_;
+            }
+
+            void open_spool()
+            {
+                spool_fd_ = ::open(options_.spool_file.c_str(), O_RDWR | O_CREAT, 0644);
+
+                if (spool_fd_ == -1)
+                {
+                    raise("Failed to open network log spool file: ", options_.spool_file);
+                }
+
+                struct stat st;
+                if (::fstat(spool_fd_, &st) == 0)
+                {
+                    spool_size_ = static_cast<std::uint64_t>(st.st_size);
+                }
+            }
+
+            bool append_spool(const batch& b)
+            {
+                spool_header header{ static_cast<std::uint32_t>(b.data.size()), b.records };
+
+                if (!write_spool(&header, sizeof(header), spool_size_) ||
+                    !write_spool(b.data.data(), b.data.size(), spool_size_ + sizeof(header)))
+                {
+                    return false;
+                }
+
+                spool_size_ += sizeof(header) + b.data.size();
+
+                return true;
+            }
+
+            bool write_spool(const void* data, std::size_t size, std::uint64_t offset)
+            {
+                auto ptr = static_cast<const char*>(data);
+
+                while (size > 0)
+                {
+                    auto res = ::pwrite(spool_fd_, ptr, size, static_cast<off_t>(offset));
+
+                    if (res < 0)
+                    {
+                        if (errno == EINTR)
+                        {
+                            continue;
+                        }
+
+                        return false;
+                    }
+
+                    ptr += res;
+                    size -= static_cast<std::size_t>(res);
+                    offset += static_cast<std::uint64_t>(res);
+                }
+
+                return true;
+            }
+
+            bool read_spool(void* data, std::size_t size, std::uint64_t offset)
+            {
+                auto ptr = static_cast<char*>(data);
+
+                while (size > 0)
+                {
+                    auto res = ::pread(spool_fd_, ptr, size, static_cast<off_t>(offset));
+
+                    if (res <= 0)
+                    {
+                        if (res < 0 && errno == EINTR)
+                        {
+                            continue;
+                        }
+
+                        return false;
+                    }
+
+                    ptr += res;
+                    size -= static_cast<std::size_t>(res);
+                    offset += static_cast<std::uint64_t>(res);
+                }
+
+                return true;
+            }
+
+            // sends all spooled batches in order and truncates the spool file afterwards
+            void replay_spool()
+            {
+                if (spool_fd_ == -1)
+                {
+                    return;
+                }
+
+                batch b;
+
+                while (!spool_empty())
+                {
+                    spool_header header;
+
+                    if (!read_spool(&header, sizeof(header), spool_offset_))
+                    {
+                        // truncated by a crash while writing, nothing left to recover
+                        break;
+                    }
+
+                    if (header.size > options_.disk_spool_size ||
+                        spool_offset_ + sizeof(header) + header.size > spool_size_)
+                    {
+                        // stale or corrupt, the rest of the spool cannot be framed anymore
+                        break;
+                    }
+
+                    b.data.resize(header.size);
+                    b.records = header.records;
+
+                    if (!read_spool(&b.data[0], b.data.size(), spool_offset_ + sizeof(header)))
+                    {
+                        break;
+                    }
+
+                    int error = send(b.data);
+
+                    if (error != 0 && !is_permanent(error))
+                    {
+                        disconnect();
+                        return;
+                    }
+
+                    spool_offset_ += sizeof(header) + b.data.size();
+
+                    if (error == 0)
+                    {
+                        sent_ += b.records;
+                        sent_bytes_ += b.data.size();
+                    }
+                    else
+                    {
+                        dropped_ += b.records;
+                        detail::stats_dropped(b.records);
+                    }
+                }
+
+                if (::ftruncate(spool_fd_, 0) == 0)
+                {
+                    spool_offset_ = spool_size_ = 0;
+                    spool_full_ = false;
+                }
+            }
+
+            bool connect()
+            {
+                addrinfo hints{};
+                hints.ai_family = AF_UNSPEC;
+                hints.ai_socktype =
+                    options_.transport == network_options::protocol::tcp ? SOCK_STREAM : SOCK_DGRAM;
+
+                addrinfo* result = nullptr;
+                if (::getaddrinfo(options_.host.c_str(), std::to_string(options_.port).c_str(),
+                                  &hints, &result) != 0)
+                {
+                    return false;
+                }
+
+                for (auto ai = result; ai != nullptr; ai = ai->ai_next)
+                {
+                    int fd = ::socket(ai->ai_family, ai->ai_socktype, ai->ai_protocol);
+
+                    if (fd == -1)
+                    {
+                        continue;
+                    }
+
+                    if (connect(fd, ai->ai_addr, ai->ai_addrlen))
+                    {
+#ifdef SO_NOSIGPIPE
+                        int on = 1;
+                        ::setsockopt(fd, SOL_SOCKET, SO_NOSIGPIPE, &on, sizeof(on));
+#endif
+                        socket_ = fd;
+                        break;
+                    }
+
+                    ::close(fd);
+                }
+
+                ::freeaddrinfo(result);
+
+                return socket_ != -1;
+            }
+
+            // connects without blocking longer than connect_timeout and leaves the socket blocking
+            bool connect(int fd, const sockaddr* addr, socklen_t addrlen)
+            {
+                int flags = ::fcntl(fd, F_GETFL, 0);
+
+                if (flags == -1 || ::fcntl(fd, F_SETFL, flags | O_NONBLOCK) == -1)
+                {
+                    return false;
+                }
+
+                if (::connect(fd, addr, addrlen) != 0)
+                {
+                    if (errno != EINPROGRESS)
+                    {
+                        return false;
+                    }
+
+                    auto deadline = clock::now() + options_.connect_timeout;
+
+                    while (true)
+                    {
+                        auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(
+                            deadline - clock::now());
+
+                        pollfd p{};
+                        p.fd = fd;
+                        p.events = POLLOUT;
+
+                        auto res = ::poll(&p, 1, static_cast<int>(std::max<std::int64_t>(
+                                                     remaining.count(), 0)));
+
+                        if (res == 1)
+                        {
+                            break;
+                        }
+
+                        if (res == 0 || errno != EINTR)
+                        {
+                            return false;
+                        }
+                    }
+
+                    int error = 0;
+                    socklen_t len = sizeof(error);
+
+                    if (::getsockopt(fd, SOL_SOCKET, SO_ERROR, &error, &len) != 0 || error != 0)
+                    {
+                        return false;
+                    }
+                }
+
+                return ::fcntl(fd, F_SETFL, flags) != -1;
+            }
+
+            void disconnect()
+            {
+                if (socket_ != -1)
+                {
+                    ::close(socket_);
+                    socket_ = -1;
+                }
+            }
+
+            // errors, which do not go away by sending the same batch again
+            static bool is_permanent(int error)
+            {
+                return error == EMSGSIZE;
+            }
+
+            // returns 0 or the errno of the failed send
+            int send(const std::string& data)
+            {
+#ifdef MSG_NOSIGNAL
+                const int flags = MSG_NOSIGNAL;
+#else
+                const int flags = 0;
+#endif
+                std::size_t pos = 0;
+
+                while (pos < data.size())
+                {
+                    auto res = ::send(socket_, data.data() + pos, data.size() - pos, flags);
+
+                    if (res < 0)
+                    {
+                        if (errno == EINTR)
+                        {
+                            continue;
+                        }
+
+                        return errno;
+                    }
+
+                    pos += static_cast<std::size_t>(res);
+                }
+
+                return 0;
+            }
+
+        private:
+            network_options options_;
+
+            std::mutex mutex_;
+            std::condition_variable cv_;
+            bool stop_ = false;
+            batch current_;
+            std::deque<batch> queue_;
+            std::size_t queued_bytes_ = 0;
+
+            // only used by the worker thread
+            int socket_ = -1;
+            int spool_fd_ = -1;
+            std::uint64_t spool_size_ = 0;
+            std::uint64_t spool_offset_ = 0;
+            bool spool_full_ = false;
+
+            std::atomic<std::uint64_t> sent_{ 0 };
+            std::atomic<std::uint64_t> sent_bytes_{ 0 };
+            std::atomic<std::uint64_t> spooled_{ 0 };
+            std::atomic<std::uint64_t> dropped_{ 0 };
+            std::atomic<std::uint64_t> truncated_{ 0 };
+
+            std::thread worker_;
+        };
+    } // namespace sink
+} // namespace log
+} // namespace nitro
+
+#endif // INCLUDE_NITRO_LOG_SINK_NETWORK_HPP
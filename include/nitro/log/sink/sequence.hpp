@@ -32,6 +32,9 @@
 
 #include <nitro/lang/tuple_foreach.hpp>
 
+#include <string>
+#include <tuple>
+
 namespace nitro
 {
 namespace log
@@ -41,19 +44,21 @@ namespace log
         template <typename... Sinks>
         class sequence
         {
-            static std::tuple<Sinks...> sinks;
+            std::tuple<Sinks...> sinks_;
 
         public:
             void sink(severity_level sev, const std::string& formatted_record)
             {
-                lang::tuple_foreach(sinks, [&sev, &formatted_record](auto& sink) {
+                lang::tuple_foreach(sinks_, [&sev, &formatted_record](auto& sink) {
                     sink.sink(sev, formatted_record);
                 });
             }
-        };
 
-        template <typename... Sinks>
-        std::tuple<Sinks...> sequence<Sinks...>::sinks;
+            std::tuple<Sinks...>& sinks()
+            {
+                return sinks_;
+            }
+        };
     } // namespace sink
 } // namespace log
 } // namespace nitro
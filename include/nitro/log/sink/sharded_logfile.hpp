@@ -0,0 +1,274 @@
+/*
+ * Copyright (c) 2026, Technische Universität Dresden, Germany
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted
+ * provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+ *    and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to
+ *    endorse or promote products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ * WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef INCLUDE_NITRO_LOG_SINK_SHARDED_LOGFILE_HPP
+#define INCLUDE_NITRO_LOG_SINK_SHARDED_LOGFILE_HPP
+
+#include <nitro/log/attribute/rank.hpp>
+#include <nitro/log/index.hpp>
+#include <nitro/log/severity.hpp>
+
+#include <nitro/env/hostname.hpp>
+#include <nitro/env/process.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace nitro
+{
+namespace log
+{
+    namespace sink
+    {
+        /**
+         * @brief Logfile sink writing to a file of its own per process, rank or thread.
+         *
+         * The file name in log_file() may contain the placeholders {hostname}, {pid}, {rank}
+         * and {tid}. The rank is the one given to rank_attribute::initialize(). If the name
+         * contains {tid}, every thread writes its own file without any locking, otherwise the
+         * threads of a process share one file. The files are only flushed for records with at
+         * least error severity and when they are closed, i.e., when their thread exits or the
+         * sink is destroyed. The files of a thread belong to the sink instance, so several
+         * instances with different file names keep separate files.
+         *
+         * Use merge_logfiles() from <nitro/log/merge.hpp> to combine the shards afterwards. If
+         * index_options() are enabled, every shard gets a sidecar index for query_logfile().
+         */
+        class ShardedLogfile
+        {
+            struct shard
+            {
+                explicit shard(const std::string& name)
+                : stream(name),
+                  index(index_options().enabled ?
+                            new detail::log_index_writer(name + ".idx", index_options()) :
+                            nullptr)
+                {
+                }
+
+                // called by the sink and the thread owning the shard, whichever ends first
+                void close()
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+
+                    if (stream.is_open())
+                    {
+                        stream.close();
+                    }
+
+                    index.reset();
+                }
+
+                std::mutex mutex;
+                std::ofstream stream;
+                std::unique_ptr<detail::log_index_writer> index;
+            };
+
+            // the shards of the calling thread, closed when it exits
+            struct thread_shards
+            {
+                ~thread_shards()
+                {
+                    for (auto& entry : entries)
+                    {
+                        entry.second->close();
+                    }
+                }
+
+                std::vector<std::pair<std::uint64_t, std::shared_ptr<shard>>> entries;
+            };
+
+        public:
+            static std::string& log_file()
+            {
+                static std::string file_name("log.{hostname}.{pid}.txt");
+                return file_name;
+            }
+
+            // expands the placeholders in log_file() for the calling thread
+            static std::string file_name()
+            {
+                return expand(log_file());
+            }
+
+            static log_index_options& index_options()
+            {
+                static log_index_options options;
+                return options;
+            }
+
+            ShardedLogfile() : ShardedLogfile(log_file())
+            {
+            }
+
+            /**
+             * @brief Writes to files named after the given pattern instead of log_file().
+             *
+             * Every instance writes its own files, so instances need different patterns.
+             */
+            explicit ShardedLogfile(std::string pattern)
+            : pattern_(std::move(pattern)),
+              per_thread_(pattern_.find("{tid}") != std::string::npos), id_(next_id())
+            {
+                if (!per_thread_)
+                {
+                    shared_.reset(new shard(expand(pattern_)));
+                }
+            }
+
+            ShardedLogfile(const ShardedLogfile&) = delete;
+            ShardedLogfile& operator=(const ShardedLogfile&) = delete;
+
+            ~ShardedLogfile()
+            {
+                for (auto& s : shards_)
+                {
+                    s->close();
+                }
+            }
+
+            void sink(severity_level sev, const std::string& formatted_record)
+            {
+                if (per_thread_)
+                {
+                    auto& s = thread_shard();
+                    write(s.stream, s.index.get(), sev, formatted_record);
+                }
+                else
+                {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    write(shared_->stream, shared_->index.get(), sev, formatted_record);
+                }
+            }
+
+        private:
+            static std::string expand(std::string result)
+            {
+                replace(result, "{hostname}", [] { return env::hostname(); });
+                replace(result, "{pid}", [] { return std::to_string(env::get_pid()); });
+                replace(result, "{tid}", [] { return std::to_string(env::get_tid()); });
+                replace(result, "{rank}", [] { return std::to_string(rank_attribute().rank()); });
+
+                return result;
+            }
+
+            template <typename Value>
+            static void replace(std::string& str, const std::string& placeholder, Value value)
+            {
+                auto pos = str.find(placeholder);
+
+                if (pos == std::string::npos)
+                {
+                    return;
+                }
+
+                auto replacement = value();
+
+                do
+                {
+                    str.replace(pos, placeholder.size(), replacement);
+                    pos = str.find(placeholder, pos + replacement.size());
+                } while (pos != std::string::npos);
+            }
+
+            // ids are never reused, so shards of destroyed instances are never found again
+            static std::uint64_t next_id()
+            {
+                static std::atomic<std::uint64_t> id(0);
+                return ++id;
+            }
+
+            shard& thread_shard()
+            {
+                static thread_local thread_shards shards;
+
+                for (auto& entry : shards.entries)
+                {
+                    if (entry.first == id_)
+                    {
+                        return *entry.second;
+                    }
+                }
+
+                auto s = std::make_shared<shard>(expand(pattern_));
+
+                {
+                    std::lock_guard<std::mutex> lock(mutex_);
+
+                    // drop the shards of exited threads
+                    shards_.erase(std::remove_if(shards_.begin(), shards_.end(),
+                                                 [](const std::shared_ptr<shard>& other) {
+                                                     return other.use_count() == 1;
+                                                 }),
+                                  shards_.end());
+
+                    shards_.push_back(s);
+                }
+
+                shards.entries.emplace_back(id_, s);
+
+                return *s;
+            }
+
+            static void write(std::ofstream& stream, detail::log_index_writer* index,
+                              severity_level sev, const std::string& formatted_record)
+            {
+                stream << formatted_record;
+
+                if (index != nullptr)
+                {
+                    index->add(sev, formatted_record);
+                }
+
+                if (sev >= severity_level::error)
+                {
+                    stream.flush();
+                }
+            }
+
+        private:
+            std::string pattern_;
+            bool per_thread_;
+            std::uint64_t id_;
+            std::mutex mutex_;
+            std::unique_ptr<shard> shared_;
+            // the shards of all threads, which used this instance, guarded by mutex_
+            std::vector<std::shared_ptr<shard>> shards_;
+        };
+    } // namespace sink
+} // namespace log
+} // namespace nitro
+
+#endif // INCLUDE_NITRO_LOG_SINK_SHARDED_LOGFILE_HPP
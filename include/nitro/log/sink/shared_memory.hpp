@@ -0,0 +1,597 @@
+/*
+ * Copyright (c) 2026, Technische Universität Dresden, Germany
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted
+ * provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+ *    and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to
+ *    endorse or promote products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ * WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef INCLUDE_NITRO_LOG_SINK_SHARED_MEMORY_HPP
+#define INCLUDE_NITRO_LOG_SINK_SHARED_MEMORY_HPP
+
+#include <nitro/log/severity.hpp>
+#include <nitro/log/stats.hpp>
+
+#include <nitro/except/raise.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include <cerrno>
+#include <csignal>
+
+extern "C"
+{
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+}
+
+namespace nitro
+{
+namespace log
+{
+    namespace detail
+    {
+        static_assert(ATOMIC_LLONG_LOCK_FREE == 2 && ATOMIC_INT_LOCK_FREE == 2,
+                      "The shared memory ring requires address-free atomics");
+
+        struct shm_ring_slot
+        {
+            static constexpr std::size_t payload = 240;
+
+            // position + 1 if published, position if free for the lap of position
+            std::atomic<std::uint64_t> seq;
+            // pid of the producer, which claimed the slot, 0 if unknown
+            std::atomic<std::int32_t> owner;
+            // number of slots of the record in its first slot, 0 in all other slots
+            std::uint16_t count;
+            std::uint16_t size;
+            char data[payload];
+        };
+
+        static_assert(sizeof(shm_ring_slot) == 256, "Unexpected padding in shm_ring_slot");
+
+        struct shm_ring_header
+        {
+            static constexpr std::uint64_t magic_value = 0x6e6974726f6c6f67; // "nitrolog"
+            static constexpr std::uint32_t version_value = 1;
+
+            std::atomic<std::uint64_t> magic;
+            std::uint32_t version;
+            std::uint32_t slot_count;
+
+            alignas(64) std::atomic<std::uint64_t> tail;
+            alignas(64) std::atomic<std::uint64_t> head;
+            std::atomic<std::uint64_t> dropped;
+            std::atomic<std::uint64_t> lost;
+        };
+
+        /**
+         * @brief Bounded multi-producer, single-consumer ring of records in a POSIX shared memory
+         * segment.
+         *
+         * A record occupies one or more consecutive slots. Producers claim slots with a single
+         * CAS on the tail, after checking that all of them were released by the consumer. Then
+         * they write their pid into the slots, the first slot last, copy the record and publish
+         * the continuation slots before the first one. Thus a published first slot implies a
+         * complete record.
+         *
+         * If a producer dies between claiming and publishing, the consumer skips its slots once
+         * they stayed unpublished for a timeout and their owner is gone. Slots without an owner
+         * are never skipped, as their producer may still be about to write its pid. Publishing
+         * checks that the slots were not skipped before copying and uses a CAS, so a producer,
+         * which was skipped, can neither overwrite other records nor corrupt the sequence
+         * numbers of the ring.
+         */
+        class shm_ring
+        {
+        public:
+            shm_ring(const std::string& name, std::uint32_t slot_count)
+            {
+                if (slot_count == 0 || (slot_count & (slot_count - 1)) != 0)
+                {
+                    raise("The slot count of a shared memory log ring must be a power of two");
+                }
+
+                size_ = sizeof(shm_ring_header) + slot_count * sizeof(shm_ring_slot);
+
+                bool created = true;
+                int fd = ::shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+
+                if (fd == -1 && errno == EEXIST)
+                {
+                    created = false;
+                    fd = ::shm_open(name.c_str(), O_RDWR, 0600);
+                }
+
+                if (fd == -1)
+                {
+                    raise("Failed to open shared memory log ring ", name, ": ",
+                          std::strerror(errno));
+                }
+
+                if (created && ::ftruncate(fd, static_cast<off_t>(size_)) != 0)
+                {
+                    ::close(fd);
+                    raise("Failed to resize shared memory log ring ", name);
+                }
+
+                if (!created)
+                {
+                    wait_for_size(fd, name);
+                }
+
+                auto addr = ::mmap(nullptr, size_, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+                ::close(fd);
+
+                if (addr == MAP_FAILED)
+                {
+                    raise("Failed to map shared memory log ring ", name);
+                }
+
+                header_ = static_cast<shm_ring_header*>(addr);
+                slots_ = reinterpret_cast<shm_ring_slot*>(header_ + 1);
+
+                if (created)
+                {
+                    initialize(slot_count);
+                }
+                else
+                {
+                    wait_for_magic(name);
+                }
+
+                mask_ = header_->slot_count - 1;
+            }
+
+            shm_ring(const shm_ring&) = delete;
+            shm_ring& operator=(const shm_ring&) = delete;
+
+            ~shm_ring()
+            {
+                ::munmap(header_, size_);
+            }
+
+            static void remove(const std::string& name)
+            {
+                ::shm_unlink(name.c_str());
+            }
+
+            std::uint32_t slot_count() const
+            {
+                return header_->slot_count;
+            }
+
+            // largest record, which fits into the ring
+            std::size_t max_record_size() const
+            {
+                return std::min<std::size_t>(header_->slot_count, 0xffff) * shm_ring_slot::payload;
+            }
+
+            /**
+             * @brief Claims the slots for a record of the given size. Returns false, if the ring
+             * is full.
+             */
+            bool claim(std::size_t size, std::uint64_t& pos, std::uint16_t& count)
+            {
+                size = std::min(size, max_record_size());
+                count = static_cast<std::uint16_t>(
+                    std::max<std::size_t>(1, (size + shm_ring_slot::payload - 1) /
+                                                 shm_ring_slot::payload));
+
+                pos = header_->tail.load(std::memory_order_relaxed);
+
+                while (true)
+                {
+                    bool free = true;
+                    for (std::uint64_t i = 0; i < count; ++i)
+                    {
+                        if (slot(pos + i).seq.load(std::memory_order_acquire) != pos + i)
+                        {
+                            free = false;
+                            break;
+                        }
+                    }
+
+                    if (!free)
+                    {
+                        auto tail = header_->tail.load(std::memory_order_relaxed);
+
+                        if (tail == pos)
+                        {
+                            // the consumer has not released the slots yet
+                            header_->dropped.fetch_add(1, std::memory_order_relaxed);
+                            return false;
+                        }
+
+                        pos = tail;
+                        continue;
+                    }
+
+                    if (header_->tail.compare_exchange_weak(pos, pos + count,
+                                                            std::memory_order_relaxed))
+                    {
+                        break;
+                    }
+                }
+
+                // the first slot last, so an owner in the first slot implies owners in all
+                auto pid = static_cast<std::int32_t>(::getpid());
+                for (std::uint64_t i = count; i-- > 0;)
+                {
+                    slot(pos + i).owner.store(pid, std::memory_order_release);
+                }
+
+                return true;
+            }
+
+            /**
+             * @brief Copies the record into the claimed slots and publishes them.
+             *
+             * Returns false, if the consumer skipped the slots in the meantime.
+             */
+            bool publish(std::uint64_t pos, std::uint16_t count, const char* data,
+                         std::size_t size)
+            {
+                size = std::min(size, max_record_size());
+
+                auto pid = static_cast<std::int32_t>(::getpid());
+                bool published = true;
+
+                // continuation slots first, so a published first slot implies a complete record
+                for (std::uint16_t i = count; i-- > 0;)
+                {
+                    auto& s = slot(pos + i);
+
+                    if (s.seq.load(std::memory_order_acquire) != pos + i ||
+                        s.owner.load(std::memory_order_relaxed) != pid)
+                    {
+                        // skipped by the consumer, the slot may belong to another record now
+                        published = false;
+                        continue;
+                    }
+
+                    auto offset = i * shm_ring_slot::payload;
+                    auto part = std::min(size - std::min(size, offset), shm_ring_slot::payload);
+
+                    std::memcpy(s.data, data + offset, part);
+                    s.size = static_cast<std::uint16_t>(part);
+                    s.count = i == 0 ? count : 0;
+
+                    auto expected = pos + i;
+                    published &= s.seq.compare_exchange_strong(expected, pos + i + 1,
+                                                               std::memory_order_release);
+                }
+
+                return published;
+            }
+
+            bool push(const char* data, std::size_t size)
+            {
+                std::uint64_t pos;
+                std::uint16_t count;
+
+                if (!claim(size, pos, count))
+                {
+                    return false;
+                }
+
+                return publish(pos, count, data, size);
+            }
+
+            /**
+             * @brief Passes all complete records to the callback and releases their slots.
+             *
+             * Slots, which stay unpublished for longer than stale_timeout while their owner is
+             * gone, are skipped. Must only be called by a single consumer at a time. The head is
+             * stored after every slot, so a consumer, which stops in between, e.g. because it
+             * crashed, leaves a ring the next one can continue with.
+             */
+            template <typename Function>
+            std::size_t drain(Function callback, std::chrono::steady_clock::duration stale_timeout)
+            {
+                std::size_t records = 0;
+                auto head = header_->head.load(std::memory_order_relaxed);
+
+                while (head != header_->tail.load(std::memory_order_acquire))
+                {
+                    auto& first = slot(head);
+                    auto seq = first.seq.load(std::memory_order_acquire);
+
+                    if (seq >= head + header_->slot_count)
+                    {
+                        // released by a previous consumer, which stopped before storing the head
+                        advance(head, 1);
+                        continue;
+                    }
+
+                    if (seq != head + 1)
+                    {
+                        if (!is_stale(head, stale_timeout))
+                        {
+                            break;
+                        }
+
+                        if (!release(head, head))
+                        {
+                            // published just now
+                            continue;
+                        }
+
+                        header_->lost.fetch_add(1, std::memory_order_relaxed);
+                        advance(head, 1);
+                        continue;
+                    }
+
+                    stale_since_ = time_point();
+                    dead_owner_ = 0;
+
+                    if (first.count == 0)
+                    {
+                        // orphaned continuation of a record, which was never completed
+                        release(head, head + 1);
+                        header_->lost.fetch_add(1, std::memory_order_relaxed);
+                        advance(head, 1);
+                        continue;
+                    }
+
+                    record_.clear();
+                    for (std::uint64_t i = 0; i < first.count; ++i)
+                    {
+                        auto& s = slot(head + i);
+                        record_.append(s.data, s.size);
+                    }
+
+                    callback(record_);
+                    ++records;
+
+                    for (std::uint64_t i = 0, count = first.count; i < count; ++i)
+                    {
+                        release(head, head + 1);
+                        advance(head, 1);
+                    }
+                }
+
+                return records;
+            }
+
+            std::uint64_t dropped() const
+            {
+                return header_->dropped.load(std::memory_order_relaxed);
+            }
+
+            std::uint64_t lost() const
+            {
+                return header_->lost.load(std::memory_order_relaxed);
+            }
+
+        private:
+            using time_point = std::chrono::steady_clock::time_point;
+
+            shm_ring_slot& slot(std::uint64_t pos)
+            {
+                return slots_[pos & mask_];
+            }
+
+            // moves the head past slots, which were released or skipped
+            void advance(std::uint64_t& head, std::uint64_t count)
+            {
+                head += count;
+                header_->head.store(head, std::memory_order_release);
+            }
+
+            // releases the slot of pos for the next lap, if its sequence number is still expected
+            bool release(std::uint64_t pos, std::uint64_t expected)
+            {
+                auto& s = slot(pos);
+                auto owner = s.owner.load(std::memory_order_relaxed);
+
+                s.owner.store(0, std::memory_order_relaxed);
+
+                if (!s.seq.compare_exchange_strong(expected, pos + header_->slot_count,
+                                                   std::memory_order_release))
+                {
+                    s.owner.store(owner, std::memory_order_relaxed);
+                    return false;
+                }
+
+                return true;
+            }
+
+            bool is_stale(std::uint64_t pos, std::chrono::steady_clock::duration timeout)
+            {
+                auto owner = slot(pos).owner.load(std::memory_order_acquire);
+
+                if (owner == 0)
+                {
+                    // claimed, but the producer has not written its pid yet
+                    stale_since_ = time_point();
+                    dead_owner_ = 0;
+                    return false;
+                }
+
+                if (owner == dead_owner_)
+                {
+                    // further slots of a producer, which is known to be gone
+                    return true;
+                }
+
+                // past the slots of the dead producer, its pid may belong to a new process now
+                dead_owner_ = 0;
+
+                auto now = std::chrono::steady_clock::now();
+
+                if (stale_pos_ != pos || stale_since_ == time_point())
+                {
+                    stale_pos_ = pos;
+                    stale_since_ = now;
+                    return false;
+                }
+
+                if (now - stale_since_ < timeout)
+                {
+                    return false;
+                }
+
+                if (::kill(owner, 0) == 0 || errno == EPERM)
+                {
+                    // a slow, but living producer
+                    return false;
+                }
+
+                stale_since_ = time_point();
+                dead_owner_ = owner;
+                return true;
+            }
+
+            void initialize(std::uint32_t slot_count)
+            {
+                header_->version = shm_ring_header::version_value;
+                header_->slot_count = slot_count;
+                header_->tail.store(0, std::memory_order_relaxed);
+                header_->head.store(0, std::memory_order_relaxed);
+                header_->dropped.store(0, std::memory_order_relaxed);
+                header_->lost.store(0, std::memory_order_relaxed);
+
+                for (std::uint32_t i = 0; i < slot_count; ++i)
+                {
+                    slots_[i].seq.store(i, std::memory_order_relaxed);
+                    slots_[i].owner.store(0, std::memory_order_relaxed);
+                }
+
+                header_->magic.store(shm_ring_header::magic_value, std::memory_order_release);
+            }
+
+            void wait_for_size(int fd, const std::string& name)
+            {
+                for (int i = 0; i < 1000; ++i)
+                {
+                    struct stat st;
+                    if (::fstat(fd, &st) == 0 && st.st_size > 0)
+                    {
+                        size_ = static_cast<std::size_t>(st.st_size);
+                        return;
+                    }
+
+                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                }
+
+                ::close(fd);
+                raise("Shared memory log ring ", name, " was not initialized");
+            }
+
+            void wait_for_magic(const std::string& name)
+            {
+                for (int i = 0; i < 1000; ++i)
+                {
+                    if (header_->magic.load(std::memory_order_acquire) ==
+                        shm_ring_header::magic_value)
+                    {
+                        if (header_->version != shm_ring_header::version_value ||
+                            size_ != sizeof(shm_ring_header) +
+                                         header_->slot_count * sizeof(shm_ring_slot))
+                        {
+                            break;
+                        }
+
+                        return;
+                    }
+
+                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                }
+
+                ::munmap(header_, size_);
+                raise("Shared memory log ring ", name, " is incompatible or was not initialized");
+            }
+
+        private:
+            std::size_t size_;
+            shm_ring_header* header_;
+            shm_ring_slot* slots_;
+            std::uint64_t mask_;
+
+            // consumer state
+            std::string record_;
+            std::uint64_t stale_pos_ = 0;
+            time_point stale_since_;
+            std::int32_t dead_owner_ = 0;
+        };
+    } // namespace detail
+
+    namespace sink
+    {
+        /**
+         * @brief Sink writing the records of all processes of a node into a shared memory ring,
+         * which is drained into a single file by a shm_collector from
+         * <nitro/log/shm_collector.hpp>.
+         *
+         * Writing a record never blocks. If the ring is full, the record is dropped and counted
+         * in the ring and in stats(). Records larger than the ring are truncated.
+         */
+        class SharedMemory
+        {
+        public:
+            static std::string& segment_name()
+            {
+                static std::string name("/nitro-log");
+                return name;
+            }
+
+            // has to be a power of two, each slot holds 240 bytes of a record
+            static std::uint32_t& slot_count()
+            {
+                static std::uint32_t count = 4096;
+                return count;
+            }
+
+            void sink(severity_level, const std::string& formatted_record)
+            {
+                std::call_once(ring_once_, [this]() {
+                    ring_.reset(new detail::shm_ring(segment_name(), slot_count()));
+                });
+
+                if (!ring_->push(formatted_record.data(), formatted_record.size()))
+                {
+                    detail::stats_dropped(1);
+                }
+            }
+
+        private:
+            std::once_flag ring_once_;
+            std::unique_ptr<detail::shm_ring> ring_;
+        };
+    } // namespace sink
+} // namespace log
+} // namespace nitro
+
+#endif // INCLUDE_NITRO_LOG_SINK_SHARED_MEMORY_HPP
@@ -0,0 +1,226 @@
+/*
+ * Copyright (c) 2026, Technische Universität Dresden, Germany
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted
+ * provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+ *    and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to
+ *    endorse or promote products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ * WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef INCLUDE_NITRO_LOG_SINK_STDOUT_OMP_BUFFERED_HPP
+#define INCLUDE_NITRO_LOG_SINK_STDOUT_OMP_BUFFERED_HPP
+
+#include <nitro/log/severity.hpp>
+
+#include <algorithm>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <string>
+
+#include <omp.h>
+
+namespace nitro
+{
+namespace log
+{
+    namespace sink
+    {
+        /**
+         * @brief Sink for OpenMP programs, which buffers records per thread of a parallel region.
+         *
+         * Inside a parallel region, every thread appends to its own buffer, indexed by its
+         * thread number in the active region, without any synchronization. A buffer is written
+         * to stdout in one piece, once it is full, a record with at least error severity arrives
+         * or flush() is called. The first record after a parallel region, flush() outside of a
+         * parallel region and the destructor write all buffers. Records of nested active parallel
+         * regions are written directly, inactive nested regions use the buffer of their thread.
+         *
+         * Only threads created by OpenMP may use this sink.
+         *
+         * With PrefixThreadId, every record is prefixed with the OpenMP thread number, as
+         * records of different threads are no longer interleaved by time.
+         */
+        template <bool PrefixThreadId = false>
+        class StdOutOmpBuffered
+        {
+            // keeps the buffers of different threads on different cache lines
+            struct alignas(64) thread_buffer
+            {
+                std::string data;
+            };
+
+        public:
+            static std::size_t& buffer_size()
+            {
+                static std::size_t size = 64 * 1024;
+                return size;
+            }
+
+            // teams might be larger than the default, but unused buffers are cheap
+            StdOutOmpBuffered()
+            : num_buffers_(std::max({ omp_get_max_threads(), omp_get_num_procs(), 256 })),
+              storage_(new char[num_buffers_ * sizeof(thread_buffer) + alignof(thread_buffer)])
+            {
+                // new[] only guarantees the alignment of over-aligned types since C++17
+                void* aligned = storage_.get();
+                std::size_t space = num_buffers_ * sizeof(thread_buffer) + alignof(thread_buffer);
+                std::align(alignof(thread_buffer), num_buffers_ * sizeof(thread_buffer), aligned,
+                           space);
+
+                buffers_ = static_cast<thread_buffer*>(aligned);
+
+                for (int i = 0; i < num_buffers_; ++i)
+                {
+                    new (&buffers_[i]) thread_buffer();
+                }
+            }
+
+            StdOutOmpBuffered(const StdOutOmpBuffered&) = delete;
+            StdOutOmpBuffered& operator=(const StdOutOmpBuffered&) = delete;
+
+            ~StdOutOmpBuffered()
+            {
+                flush_all();
+
+                for (int i = 0; i < num_buffers_; ++i)
+                {
+                    buffers_[i].~thread_buffer();
+                }
+            }
+
+            void sink(severity_level sev, const std::string& formatted_record)
+            {
+                auto buffer = local_buffer();
+
+                if (buffer == nullptr)
+                {
+                    if (!omp_in_parallel())
+                    {
+                        flush_all();
+                    }
+
+                    std::string data;
+                    append(data, formatted_record, omp_get_thread_num());
+                    write(data);
+                    return;
+                }
+
+                append(buffer->data, formatted_record, static_cast<int>(buffer - buffers_));
+
+                if (buffer->data.size() >= buffer_size() || sev >= severity_level::error)
+                {
+                    write(buffer->data);
+                }
+            }
+
+            void flush()
+            {
+                if (omp_in_parallel())
+                {
+                    auto buffer = local_buffer();
+
+                    if (buffer != nullptr)
+                    {
+                        write(buffer->data);
+                    }
+                }
+                else
+                {
+                    flush_all();
+                }
+            }
+
+        private:
+            // returns nullptr if the calling thread has no buffer of its own
+            thread_buffer* local_buffer()
+            {
+                if (!omp_in_parallel() || omp_get_active_level() > 1)
+                {
+                    return nullptr;
+                }
+
+                // threads of inactive nested regions are all number 0 of their team of one, so
+                // the number in the active region identifies the thread
+                int thread = -1;
+                for (int level = omp_get_level(); level > 0 && thread < 0; --level)
+                {
+                    if (omp_get_team_size(level) > 1)
+                    {
+                        thread = omp_get_ancestor_thread_num(level);
+                    }
+                }
+
+                if (thread < 0 || thread >= num_buffers_)
+                {
+                    return nullptr;
+                }
+
+                return &buffers_[thread];
+            }
+
+            void flush_all()
+            {
+                for (int i = 0; i < num_buffers_; ++i)
+                {
+                    write(buffers_[i].data);
+                }
+            }
+
+            static void append(std::string& data, const std::string& formatted_record, int thread)
+            {
+                if (PrefixThreadId)
+                {
+                    data += "[omp ";
+                    data += std::to_string(thread);
+                    data += "] ";
+                }
+
+                data += formatted_record;
+            }
+
+            static void write(std::string& data)
+            {
+                if (data.empty())
+                {
+                    return;
+                }
+
+#pragma omp critical(nitro_log_stdout)
+                {
+                    std::cout.write(data.data(), static_cast<std::streamsize>(data.size()));
+                    std::cout.flush();
+                }
+
+                data.clear();
+            }
+
+        private:
+            int num_buffers_;
+            std::unique_ptr<char[]> storage_;
+            thread_buffer* buffers_;
+        };
+    } // namespace sink
+} // namespace log
+} // namespace nitro
+
+#endif // INCLUDE_NITRO_LOG_SINK_STDOUT_OMP_BUFFERED_HPP
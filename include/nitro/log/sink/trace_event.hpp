@@ -0,0 +1,513 @@
+/*
+ * Copyright (c) 2026, Technische Universität Dresden, Germany
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted
+ * provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+ *    and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to
+ *    endorse or promote products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ * WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef INCLUDE_NITRO_LOG_SINK_TRACE_EVENT_HPP
+#define INCLUDE_NITRO_LOG_SINK_TRACE_EVENT_HPP
+
+#include <nitro/log/severity.hpp>
+
+#include <nitro/env/process.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace nitro
+{
+namespace log
+{
+    namespace detail
+    {
+        /**
+         * @brief Binary trace event of a fixed size. The name is either a string with static
+         * storage duration or, if it is nullptr, the text of a log record, which is truncated to
+         * the size of the text buffer.
+         */
+        struct trace_event
+        {
+            std::int64_t timestamp;
+            const char* name;
+            std::uint16_t text_size;
+            char phase;
+            severity_level severity;
+            char text[108];
+        };
+
+        static_assert(sizeof(trace_event) == 128, "Unexpected padding in trace_event");
+
+        struct trace_event_chunk
+        {
+            static const std::size_t capacity = 256;
+
+            std::atomic<std::size_t> published{ 0 };
+            std::atomic<trace_event_chunk*> next{ nullptr };
+            trace_event events[capacity];
+        };
+
+        /**
+         * @brief Single-producer, single-consumer list of event chunks.
+         *
+         * The owning thread fills the last chunk and publishes every event with a release
+         * store, so recording an event takes no lock. The consumer frees chunks, once it read
+         * all of their events and the producer moved on to the next chunk.
+         */
+        class trace_event_buffer
+        {
+        public:
+            trace_event_buffer()
+            : tid(nitro::env::get_tid()), head_(new trace_event_chunk), tail_(head_)
+            {
+            }
+
+            trace_event_buffer(const trace_event_buffer&) = delete;
+            trace_event_buffer& operator=(const trace_event_buffer&) = delete;
+
+            ~trace_event_buffer()
+            {
+                while (head_ != nullptr)
+                {
+                    auto next = head_->next.load(std::memory_order_relaxed);
+                    delete head_;
+                    head_ = next;
+                }
+            }
+
+            const int tid;
+
+            // only called by the owning thread
+            template <typename Fill>
+            void record(Fill fill)
+            {
+                auto n = tail_->published.load(std::memory_order_relaxed);
+
+                if (n == trace_event_chunk::capacity)
+                {
+                    auto chunk = new trace_event_chunk;
+                    tail_->next.store(chunk, std::memory_order_release);
+                    tail_ = chunk;
+                    n = 0;
+                }
+
+                fill(tail_->events[n]);
+                tail_->published.store(n + 1, std::memory_order_release);
+            }
+
+            // passes all events published so far to the callback, one consumer at a time
+            template <typename Function>
+            void consume(Function callback)
+            {
+                while (true)
+                {
+                    auto n = head_->published.load(std::memory_order_acquire);
+
+                    for (; read_ < n; ++read_)
+                    {
+                        callback(head_->events[read_]);
+                    }
+
+                    if (read_ < trace_event_chunk::capacity)
+                    {
+                        return;
+                    }
+
+                    auto next = head_->next.load(std::memory_order_acquire);
+
+                    if (next == nullptr)
+                    {
+                        return;
+                    }
+
+                    delete head_;
+                    head_ = next;
+                    read_ = 0;
+                }
+            }
+
+        private:
+            // only used by the consumer
+            trace_event_chunk* head_;
+            std::size_t read_ = 0;
+
+            // only used by the owning thread
+            trace_event_chunk* tail_;
+        };
+
+        inline void write_json_string(std::string& out, const char* str, std::size_t size)
+        {
+            static const char hex[] = "0123456789abcdef";
+
+            out += '"';
+
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                auto c = static_cast<unsigned char>(str[i]);
+
+                if (c == '"' || c == '\\')
+                {
+                    out += '\\';
+                    out += static_cast<char>(c);
+                }
+                else if (c < 0x20)
+                {
+                    out += "\\u00";
+                    out += hex[c >> 4];
+                    out += hex[c & 0xf];
+                }
+                else
+                {
+                    out += static_cast<char>(c);
+                }
+            }
+
+            out += '"';
+        }
+    } // namespace detail
+
+    namespace sink
+    {
+        /**
+         * @brief Sink writing a timeline in the Chrome trace event format, which can be opened
+         * in chrome://tracing or Perfetto.
+         *
+         * Spans are created with begin() and end() or with a span object, instant events with
+         * instant(). These events are of the category "trace". Log records passed to this sink
+         * become instant events of the category "log".
+         * The timestamps are taken from Clock, which should be the clock of the record's
+         * timestamp attribute.
+         *
+         * Recording an event only appends a fixed-size event to a buffer of the current thread,
+         * without taking a lock. The text of log records is truncated to 108 characters. The
+         * events are converted to JSON and written to trace_file() on flush(), when a thread
+         * exits and at the end of the program.
+         */
+        template <typename Clock = std::chrono::high_resolution_clock>
+        class TraceEvent
+        {
+        public:
+            /**
+             * @brief RAII helper for a span. The name has to be a string literal.
+             */
+            class span
+            {
+            public:
+                explicit span(const char* name) : name_(name)
+                {
+                    begin(name_);
+                }
+
+                span(const span&) = delete;
+                span& operator=(const span&) = delete;
+
+                ~span()
+                {
+                    end(name_);
+                }
+
+            private:
+                const char* name_;
+            };
+
+            static std::string& trace_file()
+            {
+                static std::string file_name("trace.json");
+                return file_name;
+            }
+
+            // the name has to be a string literal or otherwise outlive the next flush
+            static void begin(const char* name)
+            {
+                append('B', name);
+            }
+
+            static void end(const char* name)
+            {
+                append('E', name);
+            }
+
+            static void instant(const char* name)
+            {
+                append('i', name);
+            }
+
+            static void flush()
+            {
+                instance().flush();
+            }
+
+            void sink(severity_level severity, const std::string& formatted_record)
+            {
+                auto timestamp = now();
+
+                auto size = formatted_record.size();
+                while (size > 0 && formatted_record[size - 1] == '\n')
+                {
+                    --size;
+                }
+
+                local_buffer().record([&](detail::trace_event& event) {
+                    if (size > sizeof(event.text))
+                    {
+                        size = sizeof(event.text);
+
+                        // do not cut an UTF-8 sequence
+                        while (size > 0 && (formatted_record[size] & 0xc0) == 0x80)
+                        {
+                            --size;
+                        }
+                    }
+
+                    event.timestamp = timestamp;
+                    event.name = nullptr;
+                    event.text_size = static_cast<std::uint16_t>(size);
+                    event.phase = 'i';
+                    event.severity = severity;
+                    std::memcpy(event.text, formatted_record.data(), size);
+                });
+            }
+
+        private:
+            class registry
+            {
+            public:
+                registry() : pid_(nitro::env::get_pid())
+                {
+                }
+
+                ~registry()
+                {
+                    flush();
+
+                    if (file_.is_open())
+                    {
+                        file_ << "\n]\n";
+                    }
+                }
+
+                void add(detail::trace_event_buffer& buffer)
+                {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    buffers_.push_back(&buffer);
+                }
+
+                void remove(detail::trace_event_buffer& buffer)
+                {
+                    std::lock_guard<std::mutex> lock(mutex_);
+
+                    write(buffer);
+                    buffers_.erase(std::remove(buffers_.begin(), buffers_.end(), &buffer),
+                                   buffers_.end());
+                }
+
+                void flush()
+                {
+                    std::lock_guard<std::mutex> lock(mutex_);
+
+                    for (auto buffer : buffers_)
+                    {
+                        write(*buffer);
+                    }
+
+                    if (file_.is_open())
+                    {
+                        file_.flush();
+                    }
+                }
+
+            private:
+                // requires mutex_ to be locked
+                void write(detail::trace_event_buffer& buffer)
+                {
+                    out_.clear();
+
+                    buffer.consume([this, &buffer](const detail::trace_event& event) {
+                        append_event(buffer, event);
+                    });
+
+                    if (out_.empty())
+                    {
+                        return;
+                    }
+
+                    if (!file_.is_open())
+                    {
+                        file_.open(trace_file());
+                        file_ << '[';
+                    }
+
+                    file_.write(out_.data(), static_cast<std::streamsize>(out_.size()));
+                }
+
+                // requires mutex_ to be locked
+                void append_event(const detail::trace_event_buffer& buffer,
+                                  const detail::trace_event& event)
+                {
+                    out_ += first_ ? "\n" : ",\n";
+                    first_ = false;
+
+                    out_ += "{\"name\":";
+                    if (event.name != nullptr)
+                    {
+                        detail::write_json_string(out_, event.name,
+                                                  std::char_traits<char>::length(event.name));
+                    }
+                    else
+                    {
+                        detail::write_json_string(out_, event.text, event.text_size);
+                    }
+
+                    out_ += ",\"cat\":";
+                    out_ += event.name != nullptr ? "\"trace\"" : "\"log\"";
+                    out_ += ",\"ph\":\"";
+                    out_ += event.phase;
+                    out_ += "\",\"ts\":";
+                    append_microseconds(event.timestamp);
+                    out_ += ",\"pid\":";
+                    out_ += std::to_string(pid_);
+                    out_ += ",\"tid\":";
+                    out_ += std::to_string(buffer.tid);
+
+                    if (event.phase == 'i')
+                    {
+                        out_ += ",\"s\":\"t\"";
+                    }
+
+                    if (event.name == nullptr)
+                    {
+                        std::stringstream severity;
+                        severity << event.severity;
+
+                        // the severity names are padded to the same width
+                        std::string name;
+                        severity >> name;
+
+                        out_ += ",\"args\":{\"severity\":\"";
+                        out_ += name;
+                        out_ += "\"}";
+                    }
+
+                    out_ += '}';
+                }
+
+                // requires mutex_ to be locked
+                void append_microseconds(std::int64_t ns)
+                {
+                    // the sign once, as / and % keep it in both parts, e.g. for pre-epoch clocks
+                    auto abs = static_cast<std::uint64_t>(ns);
+                    if (ns < 0)
+                    {
+                        out_ += '-';
+                        abs = ~abs + 1;
+                    }
+
+                    auto fraction = std::to_string(abs % 1000);
+
+                    out_ += std::to_string(abs / 1000);
+                    out_ += '.';
+                    out_.append(3 - fraction.size(), '0');
+                    out_ += fraction;
+                }
+
+            private:
+                const int pid_;
+
+                std::mutex mutex_;
+                std::vector<detail::trace_event_buffer*> buffers_;
+
+                std::ofstream file_;
+                bool first_ = true;
+
+                std::string out_;
+            };
+
+            class buffer_handle
+            {
+            public:
+                buffer_handle() : registry_(instance())
+                {
+                    registry_.add(buffer_);
+                }
+
+                ~buffer_handle()
+                {
+                    registry_.remove(buffer_);
+                }
+
+                detail::trace_event_buffer& get()
+                {
+                    return buffer_;
+                }
+
+            private:
+                registry& registry_;
+                detail::trace_event_buffer buffer_;
+            };
+
+            static registry& instance()
+            {
+                static registry registry_;
+                return registry_;
+            }
+
+            static detail::trace_event_buffer& local_buffer()
+            {
+                static thread_local buffer_handle handle;
+                return handle.get();
+            }
+
+            static std::int64_t now()
+            {
+                return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                           Clock::now().time_since_epoch())
+                    .count();
+            }
+
+            static void append(char phase, const char* name)
+            {
+                auto timestamp = now();
+
+                local_buffer().record([&](detail::trace_event& event) {
+                    event.timestamp = timestamp;
+                    event.name = name;
+                    event.text_size = 0;
+                    event.phase = phase;
+                    event.severity = severity_level::trace;
+                });
+            }
+        };
+    } // namespace sink
+} // namespace log
+} // namespace nitro
+
+#endif // INCLUDE_NITRO_LOG_SINK_TRACE_EVENT_HPP
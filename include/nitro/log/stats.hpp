@@ -0,0 +1,421 @@
+/*
+ * Copyright (c) 2026, Technische Universität Dresden, Germany
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted
+ * provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+ *    and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to
+ *    endorse or promote products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ * WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef INCLUDE_NITRO_LOG_STATS_HPP
+#define INCLUDE_NITRO_LOG_STATS_HPP
+
+#include <nitro/log/severity.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <ostream>
+#include <thread>
+#include <vector>
+
+namespace nitro
+{
+namespace log
+{
+    /**
+     * @brief Snapshot of the self-instrumentation of nitro::log, see stats().
+     *
+     * The latency is the time spent in logger::log(), i.e., formatting the record and passing it
+     * to the sink. It is kept in a histogram with power of two buckets, where bucket i counts
+     * latencies in [2^i, 2^(i+1)) nanoseconds.
+     */
+    struct statistics
+    {
+        static constexpr std::size_t latency_buckets = 40;
+
+        std::array<std::uint64_t, 6> records{};
+        std::uint64_t filtered = 0;
+        std::uint64_t dropped = 0;
+        std::uint64_t bytes = 0;
+        std::uint64_t queue_high_water = 0;
+
+        std::array<std::uint64_t, latency_buckets> latency{};
+        std::uint64_t latency_sum = 0;
+
+        std::uint64_t records_of(severity_level sev) const
+        {
+            return records[static_cast<std::size_t>(sev)];
+        }
+
+        std::uint64_t total_records() const
+        {
+            std::uint64_t sum = 0;
+            for (auto count : records)
+            {
+                sum += count;
+            }
+            return sum;
+        }
+
+        std::chrono::nanoseconds mean_latency() const
+        {
+            auto count = total_records();
+            return std::chrono::nanoseconds(count == 0 ? 0 : latency_sum / count);
+        }
+
+        // upper bound of the bucket containing the given quantile, e.g. 0.99
+        std::chrono::nanoseconds latency_quantile(double quantile) const
+        {
+            std::uint64_t count = 0;
+            for (auto bucket : latency)
+            {
+                count += bucket;
+            }
+
+            if (count == 0)
+            {
+                return std::chrono::nanoseconds(0);
+            }
+
+            // the rank of quantile 1.0 is the last sample, not one beyond it
+            auto rank = std::min(
+                static_cast<std::uint64_t>(std::max(std::min(quantile, 1.0), 0.0) * count),
+                count - 1);
+            std::uint64_t seen = 0;
+
+            for (std::size_t i = 0; i < latency_buckets; ++i)
+            {
+                seen += latency[i];
+
+                if (seen > rank)
+                {
+                    return std::chrono::nanoseconds(std::uint64_t(1) << (i + 1));
+                }
+            }
+
+            return std::chrono::nanoseconds(0);
+        }
+    };
+
+    inline std::ostream& operator<<(std::ostream& s, const statistics& stats)
+    {
+        s << "records:";
+        for (std::size_t i = 0; i < stats.records.size(); ++i)
+        {
+            s << ' ' << static_cast<severity_level>(i) << '=' << stats.records[i];
+        }
+
+        s << " filtered=" << stats.filtered << " dropped=" << stats.dropped
+          << " bytes=" << stats.bytes << " queue_high_water=" << stats.queue_high_water
+          << " latency: mean=" << stats.mean_latency().count()
+          << "ns p50<=" << stats.latency_quantile(0.5).count()
+          << "ns p99<=" << stats.latency_quantile(0.99).count() << "ns";
+
+        return s;
+    }
+
+    namespace detail
+    {
+        class thread_stats
+        {
+        public:
+            std::array<std::atomic<std::uint64_t>, 6> records{};
+            std::atomic<std::uint64_t> filtered{ 0 };
+            std::atomic<std::uint64_t> dropped{ 0 };
+            std::atomic<std::uint64_t> bytes{ 0 };
+            std::array<std::atomic<std::uint64_t>, statistics::latency_buckets> latency{};
+            std::atomic<std::uint64_t> latency_sum{ 0 };
+
+            // only the owning thread writes, so there is no need for atomic read-modify-write
+            static void add(std::atomic<std::uint64_t>& counter, std::uint64_t value)
+            {
+                counter.store(counter.load(std::memory_order_relaxed) + value,
+                              std::memory_order_relaxed);
+            }
+
+            void add_to(statistics& stats) const
+            {
+                for (std::size_t i = 0; i < records.size(); ++i)
+                {
+                    stats.records[i] += records[i].load(std::memory_order_relaxed);
+                }
+
+                stats.filtered += filtered.load(std::memory_order_relaxed);
+                stats.dropped += dropped.load(std::memory_order_relaxed);
+                stats.bytes += bytes.load(std::memory_order_relaxed);
+
+                for (std::size_t i = 0; i < latency.size(); ++i)
+                {
+                    stats.latency[i] += latency[i].load(std::memory_order_relaxed);
+                }
+
+                stats.latency_sum += latency_sum.load(std::memory_order_relaxed);
+            }
+        };
+
+        class stats_registry
+        {
+        public:
+            static stats_registry& instance()
+            {
+                static stats_registry registry;
+                return registry;
+            }
+
+            std::atomic<bool> enabled{ false };
+            std::atomic<std::uint64_t> queue_high_water{ 0 };
+
+            void add(thread_stats& stats)
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                threads_.push_back(&stats);
+            }
+
+            // keeps the counts of threads, which exited
+            void remove(thread_stats& stats)
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+
+                stats.add_to(retired_);
+                threads_.erase(std::remove(threads_.begin(), threads_.end(), &stats),
+                               threads_.end());
+            }
+
+            statistics snapshot()
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+
+                statistics result = retired_;
+
+                for (auto stats : threads_)
+                {
+                    stats->add_to(result);
+                }
+
+                result.queue_high_water = queue_high_water.load(std::memory_order_relaxed);
+
+                return result;
+            }
+
+            void reset()
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+
+                // only for tests, racing with the owning threads is acceptable here
+                retired_ = statistics();
+                for (auto stats : threads_)
+                {
+                    for (auto& counter : stats->records)
+                    {
+                        counter = 0;
+                    }
+                    stats->filtered = 0;
+                    stats->dropped = 0;
+                    stats->bytes = 0;
+                    for (auto& counter : stats->latency)
+                    {
+                        counter = 0;
+                    }
+                    stats->latency_sum = 0;
+                }
+
+                queue_high_water = 0;
+            }
+
+        private:
+            stats_registry() = default;
+
+            std::mutex mutex_;
+            std::vector<thread_stats*> threads_;
+            statistics retired_;
+        };
+
+        class thread_stats_handle
+        {
+        public:
+            thread_stats_handle() : registry_(stats_registry::instance())
+            {
+                registry_.add(stats_);
+            }
+
+            ~thread_stats_handle()
+            {
+                registry_.remove(stats_);
+            }
+
+            thread_stats& get()
+            {
+                return stats_;
+            }
+
+        private:
+            stats_registry& registry_;
+            thread_stats stats_;
+        };
+
+        inline bool stats_enabled()
+        {
+            return stats_registry::instance().enabled.load(std::memory_order_relaxed);
+        }
+
+        inline thread_stats& local_stats()
+        {
+            static thread_local thread_stats_handle handle;
+            return handle.get();
+        }
+
+        inline void stats_logged(severity_level sev, std::size_t bytes,
+                                 std::chrono::nanoseconds latency)
+        {
+            auto& stats = local_stats();
+
+            thread_stats::add(stats.records[static_cast<std::size_t>(sev)], 1);
+            thread_stats::add(stats.bytes, bytes);
+
+            auto ns = static_cast<std::uint64_t>(std::max<std::int64_t>(latency.count(), 1));
+
+            std::size_t bucket = 0;
+            while (bucket + 1 < statistics::latency_buckets && (ns >> (bucket + 1)) != 0)
+            {
+                ++bucket;
+            }
+
+            thread_stats::add(stats.latency[bucket], 1);
+            thread_stats::add(stats.latency_sum, ns);
+        }
+
+        inline void stats_filtered()
+        {
+            if (stats_enabled())
+            {
+                thread_stats::add(local_stats().filtered, 1);
+            }
+        }
+
+        // for sinks, which have to discard records
+        inline void stats_dropped(std::uint64_t records)
+        {
+            if (stats_enabled())
+            {
+                thread_stats::add(local_stats().dropped, records);
+            }
+        }
+
+        // for sinks with a queue, reports the current number of queued records
+        inline void stats_queue_depth(std::uint64_t depth)
+        {
+            if (!stats_enabled())
+            {
+                return;
+            }
+
+            auto& high_water = stats_registry::instance().queue_high_water;
+            auto current = high_water.load(std::memory_order_relaxed);
+
+            while (depth > current &&
+                   !high_water.compare_exchange_weak(current, depth, std::memory_order_relaxed))
+            {
+            }
+        }
+    } // namespace detail
+
+    /**
+     * @brief Enables or disables the self-instrumentation, which is disabled by default.
+     *
+     * While disabled, it costs a relaxed atomic load per record.
+     */
+    inline void enable_stats(bool enable = true)
+    {
+        detail::stats_registry::instance().enabled.store(enable, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Aggregates the counters of all threads into a snapshot.
+     */
+    inline statistics stats()
+    {
+        return detail::stats_registry::instance().snapshot();
+    }
+
+    inline void reset_stats()
+    {
+        detail::stats_registry::instance().reset();
+    }
+
+    /**
+     * @brief Passes a snapshot of stats() to the given callback in regular intervals from a
+     * thread of its own, e.g. to log it.
+     */
+    class stats_dumper
+    {
+    public:
+        stats_dumper(std::chrono::milliseconds interval,
+                     std::function<void(const statistics&)> callback)
+        : interval_(interval), callback_(std::move(callback)), thread_([this]() { run(); })
+        {
+        }
+
+        stats_dumper(const stats_dumper&) = delete;
+        stats_dumper& operator=(const stats_dumper&) = delete;
+
+        ~stats_dumper()
+        {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                stop_ = true;
+            }
+
+            cv_.notify_one();
+            thread_.join();
+        }
+
+    private:
+        void run()
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+
+            while (!cv_.wait_for(lock, interval_, [this]() { return stop_; }))
+            {
+                lock.unlock();
+                callback_(stats());
+                lock.lock();
+            }
+        }
+
+    private:
+        std::chrono::milliseconds interval_;
+        std::function<void(const statistics&)> callback_;
+        std::mutex mutex_;
+        std::condition_variable cv_;
+        bool stop_ = false;
+        std::thread thread_;
+    };
+} // namespace log
+} // namespace nitro
+
+#endif // INCLUDE_NITRO_LOG_STATS_HPP
@@ -30,8 +30,10 @@
 #define INCLUDE_NITRO_LOG_STREAM_HPP
 
 #include <nitro/log/attribute/tag.hpp>
+#include <nitro/log/call_site.hpp>
 #include <nitro/log/detail/has_attribute.hpp>
 #include <nitro/log/detail/set_attribute.hpp>
+#include <nitro/log/message_stream.hpp>
 #include <nitro/log/severity.hpp>
 
 #include <nitro/lang/string_ref.hpp>
@@ -40,18 +42,18 @@
 
 #include <chrono>
 #include <memory>
-#include <sstream>
 #include <type_traits>
 
 namespace nitro
 {
 namespace log
 {
+    class stacktrace_attribute;
     class tag_attribute;
 
     template <typename Record, template <typename> class Formatter, typename Sink,
               template <typename> class Filter>
-    class logger;
+    class basic_logger;
 
     namespace detail
     {
@@ -78,7 +80,7 @@ namespace log
             {
                 if (tag)
                 {
-                    r.tag() = tag;
+                    r.tag() = tag.get();
                 }
             }
         };
@@ -90,29 +92,66 @@ namespace log
                                                                                              tag);
         }
 
+        template <typename Record, bool has_stacktrace>
+        class capture_stacktrace_attribute
+        {
+        public:
+            void operator()(Record&, severity_level)
+            {
+            }
+        };
+
+        template <typename Record>
+        class capture_stacktrace_attribute<Record, true>
+        {
+        public:
+            void operator()(Record& r, severity_level sev)
+            {
+                r.capture_stacktrace(sev);
+            }
+        };
+
+        template <typename Record>
+        void capture_stacktrace(Record& r, severity_level sev)
+        {
+            capture_stacktrace_attribute<
+                Record, detail::has_attribute<stacktrace_attribute, Record>::value>()(r, sev);
+        }
+
         template <typename Record, template <typename> class Formatter, typename Sink,
                   template <typename> class Filter, severity_level Severity>
         class smart_stream
         {
-            typedef nitro::log::logger<Record, Formatter, Sink, Filter> logger;
+            typedef nitro::log::basic_logger<Record, Formatter, Sink, Filter> logger;
 
         public:
-            smart_stream(lang::string_ref tag) : r(new Record), s()
+            smart_stream(logger& l, lang::string_ref tag) : logger_(&l), r(), s()
             {
-                detail::set_tag(*r, tag);
-                detail::set_severity<Record>()(*r, Severity);
+                open(tag);
+            }
 
-                if (logger::will_log(*r))
+            smart_stream(logger& l, call_site& site) : logger_(&l), r(), s()
+            {
+                if (site.enabled())
                 {
-                    s.reset(new std::stringstream());
+                    open(site.tag());
                 }
-                else
+
+                if (detail::call_site_stats_enabled())
                 {
-                    r.reset();
+                    if (r)
+                    {
+                        site_ = &site;
+                    }
+                    else
+                    {
+                        site.count_filtered();
+                    }
                 }
             }
 
-            smart_stream(smart_stream&& ss) : r(std::move(ss.r)), s(std::move(ss.s))
+            smart_stream(smart_stream&& ss)
+            : logger_(ss.logger_), r(std::move(ss.r)), s(std::move(ss.s)), site_(ss.site_)
             {
             }
 
@@ -120,9 +159,18 @@ namespace log
             {
                 if (r)
                 {
+                    s.flush();
                     detail::set_timestamp(*r);
-                    r->message() = s->str();
-                    logger::log(Severity, *r);
+
+                    if (site_ == nullptr)
+                    {
+                        logger_->log(Severity, *r);
+                        return;
+                    }
+
+                    auto begin = std::chrono::steady_clock::now();
+                    auto bytes = logger_->log(Severity, *r);
+                    site_->count_emitted(bytes, std::chrono::steady_clock::now() - begin);
                 }
             }
 
@@ -131,19 +179,41 @@ namespace log
                 return *r;
             }
 
-            std::stringstream& sstr()
+            message_stream& sstr()
             {
-                return *s;
+                return s;
             }
 
             operator bool() const
             {
-                return static_cast<bool>(s);
+                return static_cast<bool>(r);
             }
 
         private:
+            void open(lang::string_ref tag)
+            {
+                r.reset(new Record);
+
+                detail::set_tag(*r, tag);
+                detail::set_severity<Record>()(*r, Severity);
+
+                if (logger_->will_log(*r))
+                {
+                    detail::capture_stacktrace(*r, Severity);
+                    s = message_stream(r->message());
+                }
+                else
+                {
+                    r.reset();
+                }
+            }
+
+        private:
+            logger* logger_;
             std::unique_ptr<Record> r;
-            std::unique_ptr<std::stringstream> s;
+            message_stream s;
+            // only set while the call site stats are enabled
+            call_site* site_ = nullptr;
         };
 
         template <typename Record, template <typename> class Formatter, typename Sink,
@@ -209,7 +279,13 @@ namespace log
         class null_stream
         {
         public:
-            null_stream(lang::string_ref)
+            template <typename Logger>
+            null_stream(Logger&, lang::string_ref)
+            {
+            }
+
+            template <typename Logger>
+            null_stream(Logger&, call_site&)
             {
             }
         };
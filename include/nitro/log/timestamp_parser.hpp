@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2026, Technische Universität Dresden, Germany
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted
+ * provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+ *    and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to
+ *    endorse or promote products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ * WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef INCLUDE_NITRO_LOG_TIMESTAMP_PARSER_HPP
+#define INCLUDE_NITRO_LOG_TIMESTAMP_PARSER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <string>
+
+namespace nitro
+{
+namespace log
+{
+    namespace detail
+    {
+        // parses the optionally negative integer at pos, fails without digits or on overflow
+        inline bool parse_timestamp(const char* line, std::size_t size, std::size_t pos,
+                                    std::int64_t& timestamp)
+        {
+            bool negative = pos < size && line[pos] == '-';
+            if (negative)
+            {
+                ++pos;
+            }
+
+            auto begin = pos;
+            auto limit = static_cast<std::uint64_t>(std::numeric_limits<std::int64_t>::max()) +
+                         (negative ? 1 : 0);
+            std::uint64_t value = 0;
+
+            for (; pos < size && line[pos] >= '0' && line[pos] <= '9'; ++pos)
+            {
+                auto digit = static_cast<std::uint64_t>(line[pos] - '0');
+
+                if (value > (limit - digit) / 10)
+                {
+                    return false;
+                }
+
+                value = value * 10 + digit;
+            }
+
+            if (pos == begin)
+            {
+                return false;
+            }
+
+            // negates in unsigned arithmetic, so the minimum does not overflow
+            timestamp = negative ? static_cast<std::int64_t>(~value + 1) :
+                                   static_cast<std::int64_t>(value);
+            return true;
+        }
+    } // namespace detail
+
+    /**
+     * @brief Parses the integer at the beginning of a line, optionally enclosed in brackets,
+     * e.g. "[1596031123456789][ INFO]: ...".
+     *
+     * The line is given by its first character and size, so lines of memory mapped files are
+     * parsed in place.
+     *
+     * @return false, if the line does not start with a timestamp, which fits into 64 bits
+     */
+    inline bool leading_timestamp(const char* line, std::size_t size, std::int64_t& timestamp)
+    {
+        std::size_t pos = 0;
+
+        while (pos < size && (line[pos] == '[' || line[pos] == ' '))
+        {
+            ++pos;
+        }
+
+        return detail::parse_timestamp(line, size, pos, timestamp);
+    }
+
+    /**
+     * @brief Returns a parser for timestamps following a fixed prefix at the beginning of a line,
+     * e.g. prefixed_timestamp("ts=") for "ts=1596031123456789 ...".
+     */
+    inline std::function<bool(const char*, std::size_t, std::int64_t&)>
+    prefixed_timestamp(std::string prefix)
+    {
+        return [prefix](const char* line, std::size_t size, std::int64_t& timestamp) {
+            if (size < prefix.size() || prefix.compare(0, prefix.size(), line, prefix.size()) != 0)
+            {
+                return false;
+            }
+
+            return detail::parse_timestamp(line, size, prefix.size(), timestamp);
+        };
+    }
+} // namespace log
+} // namespace nitro
+
+#endif // INCLUDE_NITRO_LOG_TIMESTAMP_PARSER_HPP
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <nitro/log/severity.hpp>
+
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace detail
+{
+/**
+ * @brief Sink collecting the formatted records of all its instances in one static vector
+ */
+class vector_sink
+{
+public:
+    static std::vector<std::string>& records()
+    {
+        static std::vector<std::string> records_;
+        return records_;
+    }
+
+    static std::mutex& mutex()
+    {
+        static std::mutex mutex_;
+        return mutex_;
+    }
+
+    void sink(nitro::log::severity_level, const std::string& formatted_record)
+    {
+        std::lock_guard<std::mutex> lock(mutex());
+        records().push_back(formatted_record);
+    }
+};
+
+/**
+ * @brief Returns and clears the records collected by the vector_sink so far
+ */
+inline std::vector<std::string> take_records()
+{
+    std::lock_guard<std::mutex> lock(vector_sink::mutex());
+
+    std::vector<std::string> result;
+    result.swap(vector_sink::records());
+    return result;
+}
+
+/**
+ * @brief Sink collecting the formatted records in a vector of its own, one per instance
+ */
+class instance_vector_sink
+{
+public:
+    void sink(nitro::log::severity_level, const std::string& formatted_record)
+    {
+        records.push_back(formatted_record);
+    }
+
+    std::vector<std::string> records;
+};
+} // namespace detail
@@ -0,0 +1,111 @@
+#include <catch2/catch.hpp>
+
+#include <test_sinks.hpp>
+
+#include <nitro/log/severity.hpp>
+#include <nitro/log/sink/aggregate.hpp>
+
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST_CASE("Aggregate sink groups records by pattern", "[log]")
+{
+    detail::take_records();
+
+    nitro::log::sink::aggregate<detail::vector_sink> sink(std::chrono::hours(1));
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        sink.sink(nitro::log::severity_level::warn,
+                  "[" + std::to_string(100 + i) + "][queue]: queue full (" + std::to_string(i) +
+                      " pending)\n");
+    }
+
+    sink.sink(nitro::log::severity_level::info, "[5000][io]: opened file\n");
+    sink.sink(nitro::log::severity_level::error, "[5001][queue]: queue full (3 pending)\n");
+
+    REQUIRE(detail::take_records().empty());
+
+    sink.flush();
+
+    REQUIRE(detail::take_records() ==
+            std::vector<std::string>{
+                "[100][queue]: queue full (0 pending) [count=1000 first=100 last=1099]\n",
+                "[5000][io]: opened file\n", "[5001][queue]: queue full (3 pending)\n" });
+
+    sink.flush();
+    REQUIRE(detail::take_records().empty());
+}
+
+TEST_CASE("Aggregate sink passes records beyond max_groups through", "[log]")
+{
+    detail::take_records();
+
+    auto max_groups = nitro::log::sink::aggregate<detail::vector_sink>::max_groups();
+    nitro::log::sink::aggregate<detail::vector_sink>::max_groups() = 2;
+
+    {
+        nitro::log::sink::aggregate<detail::vector_sink> sink(std::chrono::hours(1));
+
+        sink.sink(nitro::log::severity_level::info, "a 1");
+        sink.sink(nitro::log::severity_level::info, "b 1");
+        sink.sink(nitro::log::severity_level::info, "c 1");
+        sink.sink(nitro::log::severity_level::info, "a 2");
+
+        REQUIRE(detail::take_records() == std::vector<std::string>{ "c 1" });
+    }
+
+    // the destructor emits the last window
+    REQUIRE(detail::take_records() == std::vector<std::string>{ "a 1 [count=2]", "b 1" });
+
+    nitro::log::sink::aggregate<detail::vector_sink>::max_groups() = max_groups;
+}
+
+TEST_CASE("Aggregate sink emits summaries per interval", "[log]")
+{
+    detail::take_records();
+
+    nitro::log::sink::aggregate<detail::vector_sink> sink(std::chrono::milliseconds(20));
+
+    for (int i = 0; i < 10; ++i)
+    {
+        sink.sink(nitro::log::severity_level::warn, "[1] storm " + std::to_string(i) + "\n");
+    }
+
+    std::vector<std::string> records;
+    for (int i = 0; i < 200 && records.empty(); ++i)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        records = detail::take_records();
+    }
+
+    // the window may close during the loop, so the records can be split over several summaries
+    REQUIRE(!records.empty());
+
+    sink.flush();
+    for (auto& record : detail::take_records())
+    {
+        records.push_back(record);
+    }
+
+    std::size_t count = 0;
+    for (auto& record : records)
+    {
+        REQUIRE(record.find("[1] storm ") == 0);
+
+        auto pos = record.find(" [count=");
+        if (pos == std::string::npos)
+        {
+            count += 1;
+        }
+        else
+        {
+            REQUIRE(record.find(" first=1 last=1]\n") != std::string::npos);
+            count += std::stoul(record.substr(pos + 8));
+        }
+    }
+
+    REQUIRE(count == 10);
+}
@@ -0,0 +1,159 @@
+#include <catch2/catch.hpp>
+
+#include <nitro/log/sink/async.hpp>
+
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+// blocks in sink() until it is opened, so the queue of the async sink fills up
+class gated_sink
+{
+public:
+    void sink(nitro::log::severity_level, const std::string& formatted_record)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+
+        entered_ = true;
+        cv_.notify_all();
+        cv_.wait(lock, [this]() { return open_; });
+
+        records_.push_back(formatted_record);
+    }
+
+    void wait_entered()
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        cv_.wait(lock, [this]() { return entered_; });
+    }
+
+    void open()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        open_ = true;
+        cv_.notify_all();
+    }
+
+    std::vector<std::string> records()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return records_;
+    }
+
+private:
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    bool entered_ = false;
+    bool open_ = false;
+    std::vector<std::string> records_;
+};
+
+template <typename Policy>
+void fill(nitro::log::sink::async<gated_sink, Policy>& sink)
+{
+    // the worker takes the first record and gets stuck in the sink
+    sink.sink(nitro::log::severity_level::info, "0");
+    sink.wrapped_sink().wait_entered();
+
+    for (int i = 1; i <= 4; ++i)
+    {
+        sink.sink(nitro::log::severity_level::info, std::to_string(i));
+    }
+}
+
+using records = std::vector<std::string>;
+} // namespace
+
+TEST_CASE("Async sink with drop_newest policy", "[log]")
+{
+    nitro::log::sink::async<gated_sink, nitro::log::sink::backpressure::drop_newest> sink(4);
+
+    fill(sink);
+    sink.sink(nitro::log::severity_level::info, "5");
+    sink.sink(nitro::log::severity_level::fatal, "6");
+
+    REQUIRE(sink.dropped() == 2);
+    REQUIRE(sink.dropped(nitro::log::severity_level::fatal) == 1);
+
+    sink.wrapped_sink().open();
+    sink.flush();
+    sink.sink(nitro::log::severity_level::info, "7");
+    sink.flush();
+
+    REQUIRE(sink.wrapped_sink().records() ==
+            records{ "0", "1", "2", "3", "4", "nitro::log: 2 records dropped\n", "7" });
+}
+
+TEST_CASE("Async sink reports drops at the end of a burst", "[log]")
+{
+    nitro::log::sink::async<gated_sink, nitro::log::sink::backpressure::drop_newest> sink(4);
+
+    fill(sink);
+    sink.sink(nitro::log::severity_level::info, "5");
+
+    sink.wrapped_sink().open();
+    sink.flush();
+
+    REQUIRE(sink.wrapped_sink().records() ==
+            records{ "0", "1", "2", "3", "4", "nitro::log: 1 records dropped\n" });
+}
+
+TEST_CASE("Async sink with drop_oldest policy", "[log]")
+{
+    nitro::log::sink::async<gated_sink, nitro::log::sink::backpressure::drop_oldest> sink(4);
+
+    fill(sink);
+    sink.sink(nitro::log::severity_level::info, "5");
+    sink.sink(nitro::log::severity_level::info, "6");
+
+    REQUIRE(sink.dropped(nitro::log::severity_level::info) == 2);
+
+    sink.wrapped_sink().open();
+    sink.flush();
+    sink.sink(nitro::log::severity_level::info, "7");
+    sink.flush();
+
+    REQUIRE(sink.wrapped_sink().records() ==
+            records{ "0", "3", "4", "5", "6", "nitro::log: 2 records dropped\n", "7" });
+}
+
+TEST_CASE("Async sink with drop_below policy keeps errors", "[log]")
+{
+    using policy =
+        nitro::log::sink::backpressure::drop_below<nitro::log::severity_level::warn>;
+
+    nitro::log::sink::async<gated_sink, policy> sink(4);
+
+    fill(sink);
+    sink.sink(nitro::log::severity_level::info, "5");
+
+    std::thread producer([&sink]() { sink.sink(nitro::log::severity_level::error, "6"); });
+
+    sink.wrapped_sink().open();
+    producer.join();
+    sink.flush();
+
+    REQUIRE(sink.dropped() == 1);
+    REQUIRE(sink.wrapped_sink().records() ==
+            records{ "0", "1", "2", "3", "4", "nitro::log: 1 records dropped\n", "6" });
+}
+
+TEST_CASE("Async sink with block policy does not drop", "[log]")
+{
+    nitro::log::sink::async<gated_sink, nitro::log::sink::backpressure::block> sink(4);
+
+    fill(sink);
+
+    std::thread producer([&sink]() { sink.sink(nitro::log::severity_level::info, "5"); });
+
+    sink.wrapped_sink().open();
+    producer.join();
+    sink.flush();
+
+    REQUIRE(sink.dropped() == 0);
+    REQUIRE(sink.wrapped_sink().records() == records{ "0", "1", "2", "3", "4", "5" });
+}
@@ -0,0 +1,213 @@
+#include <catch2/catch.hpp>
+
+#include <test_sinks.hpp>
+
+#include <nitro/log/attribute/message.hpp>
+#include <nitro/log/attribute/severity.hpp>
+#include <nitro/log/attribute/tag.hpp>
+#include <nitro/log/attribute/timestamp.hpp>
+#include <nitro/log/call_site.hpp>
+#include <nitro/log/call_site_report.hpp>
+#include <nitro/log/log.hpp>
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace detail
+{
+typedef nitro::log::record<nitro::log::tag_attribute, nitro::log::message_attribute,
+                           nitro::log::severity_attribute, nitro::log::timestamp_attribute>
+    record;
+
+template <typename Record>
+class message_formater
+{
+public:
+    std::string format(Record& r)
+    {
+        return r.message();
+    }
+};
+
+template <typename Record>
+class counting_filter
+{
+public:
+    typedef Record record_type;
+
+    static int& calls()
+    {
+        static int calls_ = 0;
+        return calls_;
+    }
+
+    bool filter(Record&) const
+    {
+        ++calls();
+        return true;
+    }
+};
+} // namespace detail
+
+using logging = nitro::log::logger<detail::record, detail::message_formater, detail::vector_sink,
+                                   detail::counting_filter>;
+
+namespace
+{
+void log_first()
+{
+    NITRO_LOG(logging, warn) << "first";
+}
+
+void log_second()
+{
+    NITRO_LOG_TAGGED(logging, error, "site tag") << "second";
+}
+
+void reset()
+{
+    nitro::log::call_site_registry::instance().reset();
+    detail::vector_sink::records().clear();
+    detail::counting_filter<detail::record>::calls() = 0;
+}
+} // namespace
+
+TEST_CASE("Call sites are enabled by default", "[log]")
+{
+    reset();
+
+    log_first();
+    log_second();
+
+    REQUIRE(detail::vector_sink::records() == std::vector<std::string>{ "first", "second" });
+    REQUIRE(detail::counting_filter<detail::record>::calls() == 2);
+
+    std::vector<int> lines;
+    nitro::log::call_site_registry::instance().for_each(
+        [&lines](const nitro::log::call_site& site) { lines.push_back(site.line()); });
+
+    REQUIRE(lines.size() >= 2);
+}
+
+TEST_CASE("Disabled call sites skip the filter", "[log]")
+{
+    reset();
+
+    auto& registry = nitro::log::call_site_registry::instance();
+
+    SECTION("By file")
+    {
+        registry.enable_file("logging_call_site_test.cpp", false);
+
+        log_first();
+        log_second();
+
+        REQUIRE(detail::vector_sink::records().empty());
+        REQUIRE(detail::counting_filter<detail::record>::calls() == 0);
+
+        registry.enable_file("tests/logging_call_site_test.cpp", true);
+
+        log_first();
+
+        REQUIRE(detail::vector_sink::records() == std::vector<std::string>{ "first" });
+    }
+
+    SECTION("By line")
+    {
+        int line = 0;
+        registry.for_each([&line](const nitro::log::call_site& site) {
+            if (site.severity() == nitro::log::severity_level::warn)
+            {
+                line = site.line();
+            }
+        });
+
+        registry.enable_line("logging_call_site_test.cpp", line, false);
+
+        log_first();
+        log_second();
+
+        REQUIRE(detail::vector_sink::records() == std::vector<std::string>{ "second" });
+    }
+
+    SECTION("By tag")
+    {
+        registry.enable_tag("site tag", false);
+
+        log_first();
+        log_second();
+
+        REQUIRE(detail::vector_sink::records() == std::vector<std::string>{ "first" });
+    }
+
+    SECTION("Partial file names do not match")
+    {
+        registry.enable_file("call_site_test.cpp", false);
+
+        log_first();
+
+        REQUIRE(detail::vector_sink::records() == std::vector<std::string>{ "first" });
+    }
+}
+
+TEST_CASE("Rules apply to call sites registered later", "[log]")
+{
+    reset();
+
+    nitro::log::call_site_registry::instance().enable_tag("late tag", false);
+
+    NITRO_LOG_TAGGED(logging, info, "late tag") << "late";
+    NITRO_LOG(logging, info) << "other";
+
+    REQUIRE(detail::vector_sink::records() == std::vector<std::string>{ "other" });
+}
+
+TEST_CASE("Call site stats count records and bytes per statement", "[log]")
+{
+    reset();
+    nitro::log::reset_call_site_stats();
+    nitro::log::enable_call_site_stats();
+
+    for (int i = 0; i < 3; ++i)
+    {
+        log_first();
+    }
+    log_second();
+
+    nitro::log::call_site_registry::instance().enable_tag("site tag", false);
+    log_second();
+
+    nitro::log::enable_call_site_stats(false);
+    log_first();
+
+    auto report = nitro::log::call_site_report();
+    REQUIRE(report.size() >= 2);
+
+    REQUIRE(report[0].severity == nitro::log::severity_level::warn);
+    REQUIRE(report[0].emitted == 3);
+    REQUIRE(report[0].filtered == 0);
+    REQUIRE(report[0].bytes == 3 * std::string("first").size());
+    REQUIRE(report[0].tag == nullptr);
+
+    REQUIRE(report[1].severity == nitro::log::severity_level::error);
+    REQUIRE(report[1].emitted == 1);
+    REQUIRE(report[1].filtered == 1);
+    REQUIRE(std::string(report[1].tag) == "site tag");
+
+    auto by_filtered = nitro::log::call_site_report(nitro::log::call_site_order::filtered);
+    REQUIRE(by_filtered[0].severity == nitro::log::severity_level::error);
+
+    std::stringstream dump;
+    nitro::log::dump_call_site_report(dump);
+
+    std::string header, first;
+    std::getline(dump, header);
+    std::getline(dump, first);
+
+    REQUIRE(header.find("emitted") != std::string::npos);
+    REQUIRE(first.find("logging_call_site_test.cpp:") != std::string::npos);
+    REQUIRE(first.find(" WARN") != std::string::npos);
+
+    reset();
+}
@@ -0,0 +1,177 @@
+#include <catch2/catch.hpp>
+
+#include <nitro/log/compressed_reader.hpp>
+#include <nitro/log/detail/crc32c.hpp>
+#include <nitro/log/detail/lz4_block.hpp>
+#include <nitro/log/sink/compressed_logfile.hpp>
+
+#include <nitro/except/exception.hpp>
+
+#include <cstdio>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <string>
+
+namespace
+{
+std::string round_trip(const std::string& input)
+{
+    nitro::log::detail::lz4_block codec;
+
+    std::string compressed(nitro::log::detail::lz4_block::bound(input.size()), '\0');
+    compressed.resize(codec.compress(input.data(), input.size(), &compressed[0]));
+
+    std::string output(input.size(), '\0');
+    REQUIRE(nitro::log::detail::lz4_block::decompress(compressed.data(), compressed.size(),
+                                                      &output[0], output.size()));
+
+    return output;
+}
+} // namespace
+
+TEST_CASE("crc32c matches the check value", "[log]")
+{
+    REQUIRE(nitro::log::detail::crc32c("123456789", 9) == 0xe3069283);
+    REQUIRE(nitro::log::detail::crc32c("", 0) == 0);
+}
+
+TEST_CASE("lz4 blocks round trip", "[log]")
+{
+    std::mt19937 random(42);
+
+    std::string random_data(100000, '\0');
+    for (auto& c : random_data)
+    {
+        c = static_cast<char>(random());
+    }
+
+    std::string log_data;
+    for (int i = 0; i < 5000; ++i)
+    {
+        log_data += "[" + std::to_string(1000000 + i * 17) + "][ INFO]: record " +
+                    std::to_string(i % 13) + "\n";
+    }
+
+    for (auto& input : { std::string(), std::string("a"), std::string("hello world"),
+                         std::string(1000, 'x'), std::string("abcabcabcabcabcabcabcabc"),
+                         random_data, log_data })
+    {
+        REQUIRE(round_trip(input) == input);
+    }
+
+    nitro::log::detail::lz4_block codec;
+    std::string compressed(nitro::log::detail::lz4_block::bound(log_data.size()), '\0');
+    auto size = codec.compress(log_data.data(), log_data.size(), &compressed[0]);
+
+    REQUIRE(size * 3 < log_data.size());
+}
+
+TEST_CASE("lz4 decompression detects corrupt data", "[log]")
+{
+    std::string output(100, '\0');
+
+    // literal length beyond the input
+    REQUIRE_FALSE(nitro::log::detail::lz4_block::decompress("\xf0\x10", 2, &output[0], 100));
+    // offset beyond the output
+    REQUIRE_FALSE(
+        nitro::log::detail::lz4_block::decompress("\x14" "abcd\x10\x00", 7, &output[0], 100));
+    // output size mismatch
+    REQUIRE_FALSE(nitro::log::detail::lz4_block::decompress("\x40" "abcd", 5, &output[0], 100));
+}
+
+TEST_CASE("Compressed logfile writes independent chunks", "[log]")
+{
+    nitro::log::sink::CompressedLogfile::log_file() = "nitro_compressed_test.nlz";
+    nitro::log::sink::CompressedLogfile::chunk_size() = 4096;
+
+    std::string expected;
+
+    {
+        nitro::log::sink::CompressedLogfile sink;
+
+        for (int i = 0; i < 2000; ++i)
+        {
+            auto record = "[" + std::to_string(i) + "][ INFO]: record " + std::to_string(i) + "\n";
+
+            sink.sink(nitro::log::severity_level::info, record);
+            expected += record;
+        }
+
+        sink.flush();
+
+        nitro::log::compressed_log_reader reader("nitro_compressed_test.nlz");
+        std::stringstream flushed;
+        reader.read_all(flushed);
+
+        REQUIRE(flushed.str() == expected);
+    }
+
+    nitro::log::compressed_log_reader reader("nitro_compressed_test.nlz");
+
+    REQUIRE(reader.chunks().size() > 10);
+
+    std::int64_t next = 0;
+    std::uint32_t records = 0;
+    for (std::size_t i = 0; i < reader.chunks().size(); ++i)
+    {
+        auto& header = reader.chunks()[i].header;
+
+        REQUIRE((header.flags & nitro::log::compressed_chunk_header::compressed) != 0);
+        REQUIRE(header.stored_size < header.size);
+        REQUIRE(header.first_timestamp == next);
+        next = header.last_timestamp + 1;
+        records += header.records;
+
+        std::string data;
+        reader.read(i, data);
+        REQUIRE(data.size() == header.size);
+    }
+
+    REQUIRE(records == 2000);
+
+    std::stringstream all;
+    reader.read_all(all);
+    REQUIRE(all.str() == expected);
+
+    std::stringstream range;
+    reader.read_all(range, 1000, 1000);
+    REQUIRE(range.str().find("[1000][ INFO]: record 1000\n") != std::string::npos);
+    REQUIRE(range.str().size() < 4096 + 100);
+
+    std::remove("nitro_compressed_test.nlz");
+}
+
+TEST_CASE("Compressed log reader detects checksum errors", "[log]")
+{
+    nitro::log::sink::CompressedLogfile::log_file() = "nitro_compressed_corrupt.nlz";
+    nitro::log::sink::CompressedLogfile::chunk_size() = 1024 * 1024;
+
+    {
+        nitro::log::sink::CompressedLogfile sink;
+
+        for (int i = 0; i < 100; ++i)
+        {
+            sink.sink(nitro::log::severity_level::info, "[" + std::to_string(i) + "] record\n");
+        }
+    }
+
+    std::size_t header_end =
+        sizeof(nitro::log::compressed_log_header) + sizeof(nitro::log::compressed_chunk_header);
+
+    {
+        std::fstream file("nitro_compressed_corrupt.nlz",
+                          std::ios::in | std::ios::out | std::ios::binary);
+        // the first literal of the first sequence
+        file.seekp(header_end + 2);
+        file.put('X');
+    }
+
+    nitro::log::compressed_log_reader reader("nitro_compressed_corrupt.nlz");
+    REQUIRE(reader.chunks().size() == 1);
+
+    std::string data;
+    REQUIRE_THROWS_AS(reader.read(0, data), nitro::except::exception);
+
+    std::remove("nitro_compressed_corrupt.nlz");
+}
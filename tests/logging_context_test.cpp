@@ -0,0 +1,143 @@
+#include <catch2/catch.hpp>
+
+#include <test_sinks.hpp>
+
+#include <nitro/log/attribute/context.hpp>
+#include <nitro/log/attribute/message.hpp>
+#include <nitro/log/attribute/severity.hpp>
+#include <nitro/log/attribute/tag.hpp>
+#include <nitro/log/attribute/timestamp.hpp>
+#include <nitro/log/filter/severity_filter.hpp>
+#include <nitro/log/log.hpp>
+
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace detail
+{
+typedef nitro::log::record<nitro::log::tag_attribute, nitro::log::message_attribute,
+                           nitro::log::severity_attribute, nitro::log::timestamp_attribute,
+                           nitro::log::context_attribute>
+    record;
+
+template <typename Record>
+class context_formater
+{
+public:
+    std::string format(Record& r)
+    {
+        std::stringstream s;
+
+        for (const auto& entry : r.context())
+        {
+            s << entry.first << "=" << entry.second << " ";
+        }
+
+        s << r.message();
+
+        return s.str();
+    }
+};
+
+template <typename Record>
+using log_filter = nitro::log::filter::severity_filter<Record>;
+} // namespace detail
+
+using logging = nitro::log::logger<detail::record, detail::context_formater, detail::vector_sink,
+                                   detail::log_filter>;
+
+TEST_CASE("Context attribute works", "[log]")
+{
+    detail::vector_sink::records().clear();
+
+    SECTION("Guards add entries for their scope")
+    {
+        logging::info() << "outside";
+
+        {
+            nitro::log::context_guard request("request", "42");
+            logging::info() << "one";
+
+            {
+                nitro::log::context_guard step("step", "7");
+                logging::info() << "two";
+            }
+
+            logging::info() << "three";
+        }
+
+        logging::info() << "after";
+
+        REQUIRE(detail::vector_sink::records().size() == 5);
+        CHECK(detail::vector_sink::records()[0] == "outside");
+        CHECK(detail::vector_sink::records()[1] == "request=42 one");
+        CHECK(detail::vector_sink::records()[2] == "request=42 step=7 two");
+        CHECK(detail::vector_sink::records()[3] == "request=42 three");
+        CHECK(detail::vector_sink::records()[4] == "after");
+    }
+
+    SECTION("Records do not copy the context")
+    {
+        nitro::log::context_guard request("request", "42");
+
+        detail::record r;
+
+        CHECK(&r.context() == &nitro::log::detail::context_stack::instance().entries());
+    }
+
+    SECTION("Copied records keep the context")
+    {
+        std::vector<detail::record> records;
+
+        {
+            nitro::log::context_guard request("request", "42");
+
+            detail::record r1;
+            detail::record r2;
+
+            records.push_back(r1);
+            records.push_back(r2);
+
+            // records of the same generation share one copy
+            CHECK(&records[0].context() == &records[1].context());
+        }
+
+        REQUIRE(records[0].context().size() == 1);
+        CHECK(records[0].context()[0].first == "request");
+        CHECK(records[0].context()[0].second == "42");
+    }
+
+    SECTION("Stale records report an empty context")
+    {
+        std::unique_ptr<detail::record> r;
+
+        {
+            nitro::log::context_guard request("request", "42");
+            r.reset(new detail::record());
+            CHECK(r->context().size() == 1);
+        }
+
+        CHECK(r->context().empty());
+    }
+
+    SECTION("Contexts are thread-local")
+    {
+        nitro::log::context_guard request("request", "42");
+
+        detail::record r;
+        std::size_t size = 42;
+        std::size_t other_size = 42;
+
+        std::thread t([&]() {
+            size = r.context().size();
+            other_size = detail::record().context().size();
+        });
+        t.join();
+
+        CHECK(size == 0);
+        CHECK(other_size == 0);
+    }
+}
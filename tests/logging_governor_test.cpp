@@ -0,0 +1,231 @@
+#include <catch2/catch.hpp>
+
+#include <nitro/log/attribute/message.hpp>
+#include <nitro/log/attribute/severity.hpp>
+#include <nitro/log/attribute/timestamp.hpp>
+#include <nitro/log/filter/governor_filter.hpp>
+#include <nitro/log/log.hpp>
+#include <nitro/log/sink/governed.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace detail
+{
+typedef nitro::log::record<nitro::log::message_attribute, nitro::log::severity_attribute,
+                           nitro::log::timestamp_attribute>
+    record;
+
+struct manual_clock
+{
+    typedef std::chrono::nanoseconds duration;
+    typedef duration::rep rep;
+    typedef duration::period period;
+    typedef std::chrono::time_point<manual_clock> time_point;
+    static const bool is_steady = true;
+
+    static std::int64_t& ticks()
+    {
+        static std::int64_t ticks_ = 1;
+        return ticks_;
+    }
+
+    static void advance(std::chrono::milliseconds ms)
+    {
+        ticks() += std::chrono::duration_cast<std::chrono::nanoseconds>(ms).count();
+    }
+
+    static time_point now()
+    {
+        return time_point(duration(ticks()));
+    }
+};
+
+template <typename Record>
+using governor = nitro::log::filter::governor_filter<Record, 0, manual_clock>;
+
+template <typename Record>
+class message_formater
+{
+public:
+    std::string format(Record& r)
+    {
+        return r.message() + "\n";
+    }
+};
+
+class counting_sink
+{
+public:
+    static std::uint64_t& records()
+    {
+        static std::uint64_t records_ = 0;
+        return records_;
+    }
+
+    void sink(nitro::log::severity_level, const std::string&)
+    {
+        ++records();
+    }
+};
+} // namespace detail
+
+using governed_logging =
+    nitro::log::logger<detail::record, detail::message_formater,
+                       nitro::log::sink::governed<detail::counting_sink,
+                                                  detail::governor<detail::record>>,
+                       detail::governor>;
+
+using governor = detail::governor<detail::record>;
+
+namespace
+{
+void burst(int count)
+{
+    for (int i = 0; i < count; ++i)
+    {
+        governed_logging::trace() << "trace " << i;
+        governed_logging::debug() << "debug " << i;
+        governed_logging::info() << "info " << i;
+    }
+
+    governed_logging::warn() << "warning";
+}
+
+void next_window()
+{
+    detail::manual_clock::advance(std::chrono::milliseconds(1000));
+}
+} // namespace
+
+TEST_CASE("Governor raises and lowers the minimum severity with the load", "[log]")
+{
+    std::vector<nitro::log::filter::governor_transition> transitions;
+
+    governor::records_budget() = 100;
+    governor::bytes_budget() = 0;
+    governor::reporter() = [&transitions](const nitro::log::filter::governor_transition& t) {
+        transitions.push_back(t);
+    };
+    governor::reset();
+
+    // the first record starts the first window
+    burst(10);
+    next_window();
+    burst(10);
+    REQUIRE(governor::min_severity() == nitro::log::severity_level::trace);
+    REQUIRE(transitions.empty());
+
+    // 301 records per second at trace, 201 at debug, 101 at info, so only warn fits
+    next_window();
+    burst(100);
+    next_window();
+    detail::counting_sink::records() = 0;
+    burst(100);
+
+    REQUIRE(governor::min_severity() == nitro::log::severity_level::warn);
+    REQUIRE(transitions.size() == 1);
+    REQUIRE(transitions[0].from == nitro::log::severity_level::trace);
+    REQUIRE(transitions[0].to == nitro::log::severity_level::warn);
+    REQUIRE(transitions[0].records_per_second == Approx(301));
+    REQUIRE(detail::counting_sink::records() == 1);
+
+    // warnings are never dropped, even when they alone exceed the budget
+    for (int i = 0; i < 500; ++i)
+    {
+        governed_logging::warn() << "warning";
+    }
+    REQUIRE(detail::counting_sink::records() == 501);
+    next_window();
+    burst(0);
+    REQUIRE(governor::min_severity() == nitro::log::severity_level::warn);
+
+    // the load subsides, the minimum severity goes down one level per window
+    burst(10);
+    next_window();
+    burst(10);
+    REQUIRE(governor::min_severity() == nitro::log::severity_level::info);
+    next_window();
+    burst(10);
+    REQUIRE(governor::min_severity() == nitro::log::severity_level::debug);
+    next_window();
+    burst(10);
+    REQUIRE(governor::min_severity() == nitro::log::severity_level::trace);
+
+    REQUIRE(transitions.size() == 4);
+    REQUIRE(governor::transitions() == 4);
+    REQUIRE(transitions.back().to == nitro::log::severity_level::trace);
+
+    std::stringstream str;
+    str << transitions[0];
+    REQUIRE(str.str().find("minimum severity raised from TRACE to") != std::string::npos);
+    REQUIRE(str.str().find("(301 records/s, 2578 bytes/s)") != std::string::npos);
+
+    governor::records_budget() = 0;
+    governor::reset();
+}
+
+TEST_CASE("Governor starts at the base severity without a reset", "[log]")
+{
+    // a separate instance, so no other test has used or reset it before
+    typedef nitro::log::filter::governor_filter<detail::record, 1, detail::manual_clock>
+        fresh_governor;
+
+    // transitions are not printed unless asked for
+    REQUIRE(!fresh_governor::reporter());
+
+    fresh_governor::base_severity() = nitro::log::severity_level::info;
+    REQUIRE(fresh_governor::min_severity() == nitro::log::severity_level::info);
+
+    fresh_governor filter;
+    detail::record r;
+
+    r.severity() = nitro::log::severity_level::debug;
+    REQUIRE(!filter.filter(r));
+
+    r.severity() = nitro::log::severity_level::info;
+    REQUIRE(filter.filter(r));
+
+    REQUIRE(fresh_governor::min_severity() == nitro::log::severity_level::info);
+    REQUIRE(fresh_governor::transitions() == 0);
+}
+
+TEST_CASE("Governor keeps the formatted bytes within the budget", "[log]")
+{
+    std::vector<nitro::log::filter::governor_transition> transitions;
+
+    governor::records_budget() = 0;
+    governor::bytes_budget() = 1000;
+    governor::reporter() = [&transitions](const nitro::log::filter::governor_transition& t) {
+        transitions.push_back(t);
+    };
+    governor::reset();
+
+    burst(0);
+    next_window();
+
+    // about 2600 bytes at trace, 1700 at debug, 800 at info
+    burst(100);
+    next_window();
+    burst(0);
+
+    REQUIRE(governor::min_severity() == nitro::log::severity_level::info);
+    REQUIRE(transitions.size() == 1);
+    REQUIRE(transitions[0].bytes_per_second > 1000);
+
+    // the sizes of filtered records are estimated from the emitted ones
+    burst(100);
+    next_window();
+    burst(0);
+    REQUIRE(governor::min_severity() == nitro::log::severity_level::info);
+
+    next_window();
+    burst(0);
+    REQUIRE(governor::min_severity() == nitro::log::severity_level::debug);
+
+    governor::bytes_budget() = 0;
+    governor::reset();
+}
@@ -0,0 +1,88 @@
+#include <catch2/catch.hpp>
+
+#include <nitro/log/hexdump.hpp>
+#include <nitro/log/message_stream.hpp>
+
+#include <cstdio>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+std::string reference_hex(const unsigned char* data, std::size_t size)
+{
+    std::string result;
+    char buffer[3];
+
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        std::snprintf(buffer, sizeof(buffer), "%02x", data[i]);
+        result += buffer;
+    }
+
+    return result;
+}
+
+template <typename T>
+std::string to_message(const T& arg)
+{
+    nitro::log::message_string str;
+    nitro::log::message_stream stream(str);
+    stream << arg;
+    return stream.str().str();
+}
+} // namespace
+
+TEST_CASE("hexdump encodes all byte values", "[log]")
+{
+    std::vector<unsigned char> data(256);
+    for (std::size_t i = 0; i < data.size(); ++i)
+    {
+        data[i] = static_cast<unsigned char>(i * 7 + 3);
+    }
+
+    for (std::size_t size = 0; size <= data.size(); size += (size < 40 ? 1 : 37))
+    {
+        REQUIRE(to_message(nitro::log::hexdump(data.data(), size)) ==
+                reference_hex(data.data(), size));
+    }
+}
+
+TEST_CASE("hexdump truncates large buffers", "[log]")
+{
+    std::string data(1000, 'x');
+
+    REQUIRE(to_message(nitro::log::hexdump(data.data(), data.size(), 4)) ==
+            "78787878... (1000 bytes)");
+    REQUIRE(to_message(nitro::log::hexdump(nullptr, 10)) == "(null)");
+}
+
+TEST_CASE("hexdump writes an ASCII column", "[log]")
+{
+    std::string data = "hello, world!\n\x01\xff" "abc";
+
+    REQUIRE(to_message(nitro::log::hexdump(data.data(), data.size()).ascii()) ==
+            "\n00000000  68 65 6c 6c 6f 2c 20 77  6f 72 6c 64 21 0a 01 ff  |hello, world!...|"
+            "\n00000010  61 62 63                                          |abc|");
+
+    REQUIRE(to_message(nitro::log::hexdump(data.data(), data.size(), 2).ascii()) ==
+            "\n00000000  68 65                                             |he|"
+            "\n... (19 bytes)");
+}
+
+TEST_CASE("hexdump works with std::ostream and formatted message streams", "[log]")
+{
+    unsigned char data[] = { 0xde, 0xad, 0xbe, 0xef };
+
+    std::ostringstream os;
+    os << nitro::log::hexdump(data, sizeof(data));
+    REQUIRE(os.str() == "deadbeef");
+
+    nitro::log::message_string str;
+    nitro::log::message_stream stream(str);
+    stream << std::hex << 255 << " " << nitro::log::hexdump(data, sizeof(data), 2) << " " << 16;
+
+    REQUIRE(stream.str() == "ff dead... (4 bytes) 10");
+}
@@ -0,0 +1,235 @@
+#include <catch2/catch.hpp>
+
+#include <nitro/log/index.hpp>
+#include <nitro/log/query.hpp>
+#include <nitro/log/severity.hpp>
+
+#include <nitro/except/exception.hpp>
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+struct test_record
+{
+    std::int64_t timestamp;
+    std::string tag;
+    nitro::log::severity_level severity;
+    std::string text;
+};
+
+std::vector<test_record> make_records()
+{
+    static const char* tags[] = { "io", "net", "compute" };
+
+    std::vector<test_record> records;
+
+    for (int i = 0; i < 2000; ++i)
+    {
+        auto sev = static_cast<nitro::log::severity_level>(i % 97 == 0 ? 4 : i % 3);
+
+        std::stringstream s;
+        s << "[" << 1000 + i * 10 << "][" << tags[(i / 100) % 3] << "][" << sev
+          << "]: record " << i << "\n";
+
+        if (i % 50 == 0)
+        {
+            s << "  continuation of record " << i << "\n";
+        }
+
+        records.push_back({ 1000 + i * 10, tags[(i / 100) % 3], sev, s.str() });
+    }
+
+    return records;
+}
+
+std::string write_log(const std::string& name, const std::vector<test_record>& records,
+                      const nitro::log::log_index_options& options)
+{
+    std::ofstream file(name);
+    nitro::log::detail::log_index_writer index(name + ".idx", options);
+
+    for (auto& record : records)
+    {
+        file << record.text;
+        index.add(record.severity, record.text);
+    }
+
+    return name;
+}
+
+std::string expected(const std::vector<test_record>& records, const nitro::log::log_query& query)
+{
+    std::string result;
+
+    for (auto& record : records)
+    {
+        if (record.timestamp >= query.from && record.timestamp <= query.to &&
+            record.severity >= query.min_severity && (query.tag.empty() || query.tag == record.tag))
+        {
+            result += record.text;
+        }
+    }
+
+    return result;
+}
+
+std::string query(const std::string& name, const nitro::log::log_query& query,
+                  const nitro::log::log_index_options& options)
+{
+    std::stringstream out;
+    nitro::log::query_logfile(name, query, out, options);
+    return out.str();
+}
+} // namespace
+
+TEST_CASE("log index blocks are ordered and cover the file", "[log]")
+{
+    nitro::log::log_index_options options;
+    options.block_size = 1024;
+    options.tag_parser = nitro::log::bracketed_field(1);
+
+    auto records = make_records();
+    auto name = write_log("nitro_index_test_blocks.log", records, options);
+
+    nitro::log::log_index index(name + ".idx");
+
+    REQUIRE(index.size() > 10);
+
+    std::uint64_t offset = 0;
+    for (auto& entry : index)
+    {
+        REQUIRE(entry.offset == offset);
+        REQUIRE(entry.first_timestamp <= entry.last_timestamp);
+        offset += entry.size;
+    }
+
+    std::ifstream file(name, std::ios::ate);
+    REQUIRE(offset == static_cast<std::uint64_t>(file.tellg()));
+
+    std::remove(name.c_str());
+    std::remove((name + ".idx").c_str());
+}
+
+TEST_CASE("log queries return the same records with and without index", "[log]")
+{
+    nitro::log::log_index_options options;
+    options.block_size = 1024;
+    options.tag_parser = nitro::log::bracketed_field(1);
+
+    auto records = make_records();
+    auto name = write_log("nitro_index_test_query.log", records, options);
+
+    std::vector<nitro::log::log_query> queries(5);
+    queries[1].from = 5000;
+    queries[1].to = 6000;
+    queries[2].min_severity = nitro::log::severity_level::error;
+    queries[3].tag = "net";
+    queries[3].from = 4000;
+    queries[4].tag = "unknown";
+
+    for (auto& q : queries)
+    {
+        auto with_index = query(name, q, options);
+
+        std::remove((name + ".idx").c_str());
+        auto without_index = query(name, q, options);
+        write_log(name, records, options);
+
+        REQUIRE(with_index == expected(records, q));
+        REQUIRE(without_index == with_index);
+    }
+
+    std::remove(name.c_str());
+    std::remove((name + ".idx").c_str());
+}
+
+TEST_CASE("log queries scan records after the last index entry", "[log]")
+{
+    nitro::log::log_index_options options;
+    options.block_size = 1024;
+
+    auto records = make_records();
+    auto name = write_log("nitro_index_test_tail.log", records, options);
+
+    {
+        std::ofstream file(name, std::ios::app);
+        file << "[100000][io][ INFO]: unindexed\n";
+    }
+
+    nitro::log::log_query q;
+    q.from = 100000;
+
+    REQUIRE(query(name, q, options) == "[100000][io][ INFO]: unindexed\n");
+
+    std::remove(name.c_str());
+    std::remove((name + ".idx").c_str());
+}
+
+TEST_CASE("log indexes continue when the log file is appended to", "[log]")
+{
+    nitro::log::log_index_options options;
+    options.block_size = 1024;
+    options.tag_parser = nitro::log::bracketed_field(1);
+
+    auto records = make_records();
+    std::vector<test_record> first(records.begin(), records.begin() + 1000);
+    std::vector<test_record> second(records.begin() + 1000, records.end());
+
+    auto name = write_log("nitro_index_test_append.log", first, options);
+
+    SECTION("The existing index is continued")
+    {
+    }
+
+    SECTION("A missing index covers the existing records by one block")
+    {
+        std::remove((name + ".idx").c_str());
+    }
+
+    {
+        std::ifstream size(name, std::ios::ate);
+        std::ofstream file(name, std::ios::app);
+        nitro::log::detail::log_index_writer index(
+            name + ".idx", options, static_cast<std::uint64_t>(size.tellg()));
+
+        for (auto& record : second)
+        {
+            file << record.text;
+            index.add(record.severity, record.text);
+        }
+    }
+
+    std::uint64_t offset = 0;
+    for (auto& entry : nitro::log::log_index(name + ".idx"))
+    {
+        REQUIRE(entry.offset == offset);
+        offset += entry.size;
+    }
+
+    std::ifstream file(name, std::ios::ate);
+    REQUIRE(offset == static_cast<std::uint64_t>(file.tellg()));
+
+    nitro::log::log_query q;
+    q.tag = "net";
+    q.from = 4000;
+    q.to = 16000;
+    REQUIRE(query(name, q, options) == expected(records, q));
+
+    std::remove(name.c_str());
+    std::remove((name + ".idx").c_str());
+}
+
+TEST_CASE("log queries by tag require a tag parser", "[log]")
+{
+    nitro::log::log_query q;
+    q.tag = "io";
+
+    std::stringstream out;
+    REQUIRE_THROWS_AS(nitro::log::query_logfile("does_not_matter.log", q, out),
+                      nitro::except::exception);
+}
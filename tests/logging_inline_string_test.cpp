@@ -0,0 +1,140 @@
+#include <catch2/catch.hpp>
+
+#include <nitro/log/inline_string.hpp>
+
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+using string = nitro::log::basic_inline_string<16>;
+
+TEST_CASE("Inline strings store short strings inline", "[log]")
+{
+    string str("short");
+
+    CHECK(str.is_inline());
+    CHECK(str.size() == 5);
+    CHECK(str == "short");
+    CHECK(std::string(str) == "short");
+
+    str += " but growing beyond the capacity";
+
+    CHECK(!str.is_inline());
+    CHECK(str == std::string("short but growing beyond the capacity"));
+    CHECK(str.c_str()[str.size()] == '\0');
+}
+
+TEST_CASE("Inline strings move their heap buffer", "[log]")
+{
+    string str("a string beyond the inline capacity");
+    auto data = str.data();
+
+    string moved(std::move(str));
+
+    CHECK(moved.data() == data);
+    CHECK(str.empty());
+    CHECK(str.is_inline());
+
+    string copy(moved);
+
+    CHECK(copy.data() != data);
+    CHECK(copy == moved);
+
+    str = string("short");
+    CHECK(str == "short");
+    CHECK(str.is_inline());
+}
+
+TEST_CASE("Inline strings can append parts of themselves", "[log]")
+{
+    string str("0123456789");
+
+    // grows the inline buffer
+    str.append(str.data(), str.size());
+    CHECK(str == "01234567890123456789");
+
+    // grows the heap buffer
+    str.append(str.data() + 10, 10);
+    str.append(str.data(), str.size());
+    CHECK(str.size() == 60);
+    CHECK(std::string(str.data(), 30) == "012345678901234567890123456789");
+    CHECK(std::string(str.data() + 30, 30) == std::string(str.data(), 30));
+}
+
+TEST_CASE("Inline strings work with std::string", "[log]")
+{
+    string tag("tag");
+    string message("message");
+
+    CHECK(tag + ": " + message == "tag: message");
+    CHECK(std::string("[") + tag == "[tag");
+    CHECK(tag + message == "tagmessage");
+    CHECK("tag" == tag);
+    CHECK(tag != message);
+    CHECK(tag != "message");
+    CHECK(std::string("message") != tag);
+}
+
+namespace
+{
+template <typename T, typename = void>
+struct comparable_with_string : std::false_type
+{
+};
+
+template <typename T>
+struct comparable_with_string<T, decltype(void(std::declval<const T&>() ==
+                                               std::declval<const string&>()))>
+: std::true_type
+{
+};
+} // namespace
+
+TEST_CASE("Inline strings only compare with strings", "[log]")
+{
+    CHECK(comparable_with_string<std::string>::value);
+    CHECK(comparable_with_string<const char*>::value);
+    CHECK(comparable_with_string<string>::value);
+    CHECK(!comparable_with_string<std::vector<int>>::value);
+    CHECK(!comparable_with_string<double>::value);
+}
+
+TEST_CASE("Inline strings treat nullptr as the empty string", "[log]")
+{
+    const char* null = nullptr;
+
+    string str(null);
+    CHECK(str.empty());
+    CHECK(str == null);
+    CHECK(str == "");
+
+    str = "not empty";
+    str = null;
+    CHECK(str.size() == 0);
+    CHECK(str.c_str()[0] == '\0');
+
+    str += null;
+    CHECK(str.empty());
+}
+
+TEST_CASE("Inline string streams write into the string", "[log]")
+{
+    string str;
+
+    {
+        nitro::log::detail::inline_string_stream<string> stream(str);
+
+        stream << "value: " << 42;
+        stream.commit();
+
+        CHECK(str == "value: 42");
+        CHECK(str.is_inline());
+
+        stream << ", " << std::string(100, 'x') << '!';
+        stream.commit();
+    }
+
+    CHECK(str.size() == 9 + 2 + 100 + 1);
+    CHECK(str == "value: 42, " + std::string(100, 'x') + "!");
+}
@@ -0,0 +1,173 @@
+#include <catch2/catch.hpp>
+
+#include <test_sinks.hpp>
+
+#include <nitro/log/attribute/message.hpp>
+#include <nitro/log/attribute/severity.hpp>
+#include <nitro/log/attribute/timestamp.hpp>
+#include <nitro/log/filter/severity_filter.hpp>
+#include <nitro/log/log.hpp>
+#include <nitro/log/query.hpp>
+#include <nitro/log/sink/logfile.hpp>
+#include <nitro/log/sink/sequence.hpp>
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace detail
+{
+typedef nitro::log::record<nitro::log::message_attribute, nitro::log::severity_attribute,
+                           nitro::log::timestamp_attribute>
+    record;
+
+template <typename Record>
+class message_formater
+{
+public:
+    std::string format(Record& r)
+    {
+        return r.message() + "\n";
+    }
+};
+
+template <typename Record>
+using log_filter = nitro::log::filter::severity_filter<Record>;
+
+std::string read_file(const std::string& file_name)
+{
+    std::ifstream file(file_name);
+    std::stringstream str;
+    str << file.rdbuf();
+    return str.str();
+}
+} // namespace detail
+
+using vector_logger = nitro::log::basic_logger<detail::record, detail::message_formater,
+                                               detail::instance_vector_sink, detail::log_filter>;
+
+using file_logger = nitro::log::basic_logger<detail::record, detail::message_formater,
+                                             nitro::log::sink::Logfile, detail::log_filter>;
+
+using vector_logging = nitro::log::logger<detail::record, detail::message_formater,
+                                          detail::instance_vector_sink, detail::log_filter>;
+
+TEST_CASE("Logger instances of the same type have their own sinks", "[log]")
+{
+    vector_logger first;
+    vector_logger second;
+
+    first.info() << "first " << 1;
+    second.warn() << "second";
+    first.error() << "first " << 2;
+    vector_logging::info() << "global";
+
+    REQUIRE(first.sink_instance().records == std::vector<std::string>{ "first 1\n", "first 2\n" });
+    REQUIRE(second.sink_instance().records == std::vector<std::string>{ "second\n" });
+    REQUIRE(vector_logging::sink_instance().records == std::vector<std::string>{ "global\n" });
+
+    NITRO_LOG_INSTANCE(second, info) << "with call site";
+    REQUIRE(second.sink_instance().records.back() == "with call site\n");
+    REQUIRE(first.sink_instance().records.size() == 2);
+}
+
+TEST_CASE("Logfile instances write to their own files", "[log]")
+{
+    std::remove("nitro_instance_a.txt");
+    std::remove("nitro_instance_b.txt");
+
+    {
+        file_logger a("nitro_instance_a.txt");
+        file_logger b("nitro_instance_b.txt");
+
+        a.info() << "to a";
+        b.info() << "to b";
+        a.info() << "to a again";
+    }
+
+    REQUIRE(detail::read_file("nitro_instance_a.txt") == "to a\nto a again\n");
+    REQUIRE(detail::read_file("nitro_instance_b.txt") == "to b\n");
+
+    std::remove("nitro_instance_a.txt");
+    std::remove("nitro_instance_b.txt");
+}
+
+TEST_CASE("Logfile instances share the stream of a file", "[log]")
+{
+    std::remove("nitro_instance_shared.txt");
+
+    {
+        file_logger a("nitro_instance_shared.txt");
+        file_logger b("nitro_instance_shared.txt");
+
+        a.info() << "from a";
+        b.info() << "from b";
+        a.info() << "from a again";
+
+        REQUIRE(&a.sink_instance().stream() == &b.sink_instance().stream());
+    }
+
+    {
+        // opened again later, so it appends
+        file_logger c("nitro_instance_shared.txt");
+        c.info() << "from c";
+    }
+
+    REQUIRE(detail::read_file("nitro_instance_shared.txt") ==
+            "from a\nfrom b\nfrom a again\nfrom c\n");
+
+    std::remove("nitro_instance_shared.txt");
+}
+
+TEST_CASE("Logfile indexes continue when a file is appended to", "[log]")
+{
+    std::remove("nitro_instance_indexed.txt");
+
+    auto& options = nitro::log::sink::Logfile::index_options();
+    options.enabled = true;
+
+    {
+        file_logger a("nitro_instance_indexed.txt");
+        a.info() << "first";
+    }
+
+    {
+        file_logger b("nitro_instance_indexed.txt");
+        b.info() << "second";
+    }
+
+    options.enabled = false;
+
+    std::uint64_t offset = 0;
+    for (auto& entry : nitro::log::log_index("nitro_instance_indexed.txt.idx"))
+    {
+        REQUIRE(entry.offset == offset);
+        offset += entry.size;
+    }
+
+    REQUIRE(offset == detail::read_file("nitro_instance_indexed.txt").size());
+
+    std::remove("nitro_instance_indexed.txt");
+    std::remove("nitro_instance_indexed.txt.idx");
+}
+
+TEST_CASE("Sequence sinks are per instance", "[log]")
+{
+    using vector_sequence =
+        nitro::log::sink::sequence<detail::instance_vector_sink, detail::instance_vector_sink>;
+    using sequence_logger = nitro::log::basic_logger<detail::record, detail::message_formater,
+                                                     vector_sequence, detail::log_filter>;
+
+    sequence_logger first;
+    sequence_logger second;
+
+    first.info() << "first";
+
+    REQUIRE(std::get<0>(first.sink_instance().sinks()).records.size() == 1);
+    REQUIRE(std::get<1>(first.sink_instance().sinks()).records.size() == 1);
+    REQUIRE(std::get<0>(second.sink_instance().sinks()).records.empty());
+}
@@ -0,0 +1,111 @@
+#include <catch2/catch.hpp>
+
+#include <nitro/log/lazy.hpp>
+#include <nitro/log/message_stream.hpp>
+
+#include <cstdint>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+#include <string>
+
+namespace
+{
+struct point
+{
+    int x, y;
+};
+
+std::ostream& operator<<(std::ostream& s, const point& p)
+{
+    return s << "(" << p.x << ", " << p.y << ")";
+}
+
+template <typename T>
+void check_same_as_ostream(const T& value)
+{
+    std::ostringstream expected;
+    expected << value;
+
+    nitro::log::message_string str;
+    nitro::log::message_stream stream(str);
+    stream << value;
+
+    CHECK(stream.str() == expected.str());
+}
+} // namespace
+
+TEST_CASE("Message streams write like std::ostream", "[log]")
+{
+    SECTION("Integers")
+    {
+        check_same_as_ostream(0);
+        check_same_as_ostream(7);
+        check_same_as_ostream(-42);
+        check_same_as_ostream(1234567890);
+        check_same_as_ostream(std::numeric_limits<int>::min());
+        check_same_as_ostream(std::numeric_limits<long long>::min());
+        check_same_as_ostream(std::numeric_limits<unsigned long long>::max());
+        check_same_as_ostream(static_cast<short>(-300));
+        check_same_as_ostream(static_cast<unsigned short>(65535));
+        check_same_as_ostream(std::size_t(100));
+        check_same_as_ostream(true);
+    }
+
+    SECTION("Floating point numbers")
+    {
+        check_same_as_ostream(0.0);
+        check_same_as_ostream(0.1);
+        check_same_as_ostream(-1.5f);
+        check_same_as_ostream(1.0 / 3.0);
+        check_same_as_ostream(123456789.0);
+        check_same_as_ostream(1e100);
+        check_same_as_ostream(1.25e-7);
+        check_same_as_ostream(42.0L);
+        check_same_as_ostream(std::numeric_limits<double>::infinity());
+    }
+
+    SECTION("Characters and strings")
+    {
+        check_same_as_ostream('x');
+        check_same_as_ostream("literal");
+        check_same_as_ostream(std::string(200, 'y'));
+        check_same_as_ostream(nitro::lang::string_ref("string_ref"));
+        check_same_as_ostream(nitro::log::severity_level::warn);
+    }
+
+    SECTION("User types")
+    {
+        check_same_as_ostream(point{ 1, 2 });
+    }
+}
+
+TEST_CASE("Message streams mix fast and adapted output", "[log]")
+{
+    nitro::log::message_string str;
+    nitro::log::message_stream stream(str);
+
+    stream << "a" << point{ 1, 2 } << 3 << ' ' << std::string("b") << 4.5;
+    CHECK(stream.str() == "a(1, 2)3 b4.5");
+
+    stream << ' ' << std::hex << 255 << ' ' << std::setw(4) << std::setfill('0') << 7;
+    CHECK(stream.str() == "a(1, 2)3 b4.5 ff 0007");
+}
+
+TEST_CASE("Lazy arguments write directly into message streams", "[log]")
+{
+    nitro::log::message_string str;
+    nitro::log::message_stream stream(str);
+
+    bool direct = false;
+
+    stream << nitro::log::lazy([&direct](auto& os) {
+        direct = std::is_same<std::decay_t<decltype(os)>, nitro::log::message_stream>::value;
+        os << "lazy " << 1;
+    });
+    stream << nitro::log::lazy([](std::ostream& os) { os << ", ostream " << 2; });
+    stream << nitro::log::lazy_format(", {}={}", "format", 3);
+
+    CHECK(direct);
+    CHECK(stream.str() == "lazy 1, ostream 2, format=3");
+}
@@ -0,0 +1,153 @@
+#include <catch2/catch.hpp>
+
+#include <nitro/log/sink/mpi_gather.hpp>
+
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <mpi.h>
+
+namespace
+{
+class capture_stdout
+{
+public:
+    capture_stdout() : old_(std::cout.rdbuf(out_.rdbuf()))
+    {
+    }
+
+    ~capture_stdout()
+    {
+        std::cout.rdbuf(old_);
+    }
+
+    std::string str() const
+    {
+        return out_.str();
+    }
+
+private:
+    std::stringstream out_;
+    std::streambuf* old_;
+};
+
+// every line is "<round> <rank>"
+std::vector<std::pair<int, int>> parse(const std::string& text)
+{
+    std::vector<std::pair<int, int>> result;
+    std::istringstream in(text);
+
+    int round, rank;
+    while (in >> round >> rank)
+    {
+        result.emplace_back(round, rank);
+    }
+
+    return result;
+}
+
+void log_rounds(nitro::log::sink::MpiGather& sink, int rounds, int rank, bool silent = false)
+{
+    for (int round = 0; round < rounds; ++round)
+    {
+        if (!silent)
+        {
+            sink.sink(nitro::log::severity_level::info,
+                      std::to_string(round) + " " + std::to_string(rank) + "\n");
+        }
+
+        // all records of a round are older than those of the next round
+        MPI_Barrier(MPI_COMM_WORLD);
+    }
+}
+
+void check_rounds(const std::string& output, int rounds, int size)
+{
+    auto records = parse(output);
+
+    REQUIRE(records.size() == static_cast<std::size_t>(rounds * size));
+
+    for (std::size_t i = 1; i < records.size(); ++i)
+    {
+        REQUIRE(records[i - 1].first <= records[i].first);
+    }
+}
+} // namespace
+
+// MPI can only be initialized once, so everything runs in one test case
+TEST_CASE("MPI sink gathers records on the writer rank", "[log]")
+{
+    MPI_Init(nullptr, nullptr);
+
+    int rank, size;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &size);
+
+    nitro::log::sink::MpiGather::batch_size() = 16;
+
+    std::string output;
+
+    // the remaining records are gathered, when the sink is destroyed
+    {
+        capture_stdout out;
+
+        {
+            nitro::log::sink::MpiGather sink;
+            log_rounds(sink, 20, rank);
+            sink.flush();
+        }
+
+        output = out.str();
+    }
+
+    if (rank == 0)
+    {
+        check_rounds(output, 20, size);
+    }
+    else
+    {
+        REQUIRE(output.empty());
+    }
+
+    // the last rank never logs, but has to take part nonetheless
+    auto silent = size > 1 && rank == size - 1;
+    auto logging_ranks = size > 1 ? size - 1 : size;
+
+    {
+        capture_stdout out;
+
+        {
+            nitro::log::sink::MpiGather sink;
+            log_rounds(sink, 20, rank, silent);
+        }
+
+        output = out.str();
+    }
+
+    if (rank == 0)
+    {
+        check_rounds(output, 20, logging_ranks);
+    }
+
+    // the remaining records are gathered in MPI_Finalize, also from the silent rank
+    auto sink = new nitro::log::sink::MpiGather();
+
+    {
+        capture_stdout out;
+
+        log_rounds(*sink, 20, rank, silent);
+
+        MPI_Finalize();
+
+        output = out.str();
+    }
+
+    delete sink;
+
+    if (rank == 0)
+    {
+        check_rounds(output, 20, logging_ranks);
+    }
+}
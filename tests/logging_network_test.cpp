@@ -0,0 +1,337 @@
+#include <catch2/catch.hpp>
+
+#include <nitro/log/sink/network.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <thread>
+
+extern "C"
+{
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+}
+
+namespace
+{
+int bind_loopback(int type, std::uint16_t& port)
+{
+    int fd = ::socket(AF_INET, type, 0);
+
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    addr.sin_port = 0;
+
+    REQUIRE(::bind(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) == 0);
+
+    socklen_t len = sizeof(addr);
+    REQUIRE(::getsockname(fd, reinterpret_cast<sockaddr*>(&addr), &len) == 0);
+    port = ntohs(addr.sin_port);
+
+    return fd;
+}
+
+std::string read_all(int listener)
+{
+    int fd = ::accept(listener, nullptr, nullptr);
+
+    std::string result;
+    char buffer[4096];
+    ssize_t res;
+
+    while ((res = ::recv(fd, buffer, sizeof(buffer), 0)) > 0)
+    {
+        result.append(buffer, static_cast<std::size_t>(res));
+    }
+
+    ::close(fd);
+
+    return result;
+}
+
+template <typename Predicate>
+bool wait_for(Predicate p)
+{
+    for (int i = 0; i < 500 && !p(); ++i)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    return p();
+}
+
+std::string record(int i)
+{
+    return "record " + std::to_string(i) + "\n";
+}
+} // namespace
+
+TEST_CASE("Network sink sends batched records over TCP", "[log]")
+{
+    std::uint16_t port;
+    int listener = bind_loopback(SOCK_STREAM, port);
+    REQUIRE(::listen(listener, 1) == 0);
+
+    std::string received;
+    std::thread collector([&]() { received = read_all(listener); });
+
+    nitro::log::sink::network_options options;
+    options.port = port;
+    options.batch_size = 256;
+
+    std::string expected;
+    nitro::log::sink::network_stats stats;
+
+    {
+        nitro::log::sink::Network sink(options);
+
+        for (int i = 0; i < 1000; ++i)
+        {
+            sink.sink(nitro::log::severity_level::info, record(i));
+            expected += record(i);
+        }
+
+        sink.flush();
+        REQUIRE(wait_for([&]() { return sink.stats().sent == 1000; }));
+
+        stats = sink.stats();
+    }
+
+    collector.join();
+    ::close(listener);
+
+    REQUIRE(received == expected);
+    REQUIRE(stats.sent_bytes == expected.size());
+    REQUIRE(stats.spooled == 0);
+    REQUIRE(stats.dropped == 0);
+}
+
+TEST_CASE("Network sink sends datagrams over UDP", "[log]")
+{
+    std::uint16_t port;
+    int collector = bind_loopback(SOCK_DGRAM, port);
+
+    nitro::log::sink::network_options options;
+    options.port = port;
+    options.transport = nitro::log::sink::network_options::protocol::udp;
+
+    {
+        nitro::log::sink::Network sink(options);
+
+        sink.sink(nitro::log::severity_level::info, record(1));
+        sink.sink(nitro::log::severity_level::info, record(2));
+    }
+
+    char buffer[1024];
+    auto res = ::recv(collector, buffer, sizeof(buffer), 0);
+    ::close(collector);
+
+    REQUIRE(res > 0);
+    REQUIRE(std::string(buffer, static_cast<std::size_t>(res)) == record(1) + record(2));
+}
+
+TEST_CASE("Network sink truncates records beyond the datagram size", "[log]")
+{
+    std::uint16_t port;
+    int collector = bind_loopback(SOCK_DGRAM, port);
+
+    nitro::log::sink::network_options options;
+    options.port = port;
+    options.transport = nitro::log::sink::network_options::protocol::udp;
+    options.batch_size = 1024;
+
+    std::string large(4000, 'x');
+    large += "\n";
+
+    nitro::log::sink::network_stats stats;
+
+    {
+        nitro::log::sink::Network sink(options);
+
+        sink.sink(nitro::log::severity_level::info, large);
+        sink.sink(nitro::log::severity_level::info, record(1));
+        sink.flush();
+
+        REQUIRE(wait_for([&]() { return sink.stats().sent == 2; }));
+        stats = sink.stats();
+    }
+
+    char buffer[8192];
+    auto first = ::recv(collector, buffer, sizeof(buffer), 0);
+    REQUIRE(first == 1024);
+    REQUIRE(std::string(buffer, 1023) == std::string(1023, 'x'));
+    REQUIRE(buffer[1023] == '\n');
+
+    auto second = ::recv(collector, buffer, sizeof(buffer), 0);
+    ::close(collector);
+
+    REQUIRE(second > 0);
+    REQUIRE(std::string(buffer, static_cast<std::size_t>(second)) == record(1));
+    REQUIRE(stats.truncated == 1);
+    REQUIRE(stats.dropped == 0);
+}
+
+TEST_CASE("Network sink spools records until the collector is reachable", "[log]")
+{
+    const char* spool_file = "test_network_spool.bin";
+    std::remove(spool_file);
+
+    // connecting to a bound socket, which does not listen yet, is refused
+    std::uint16_t port;
+    int listener = bind_loopback(SOCK_STREAM, port);
+
+    nitro::log::sink::network_options options;
+    options.port = port;
+    options.batch_size = 64;
+    options.flush_interval = std::chrono::milliseconds(10);
+    options.min_backoff = std::chrono::milliseconds(10);
+    options.max_backoff = std::chrono::milliseconds(20);
+    options.spool_file = spool_file;
+
+    std::string expected;
+    std::string received;
+    std::thread collector;
+
+    {
+        nitro::log::sink::Network sink(options);
+
+        for (int i = 0; i < 100; ++i)
+        {
+            sink.sink(nitro::log::severity_level::info, record(i));
+            expected += record(i);
+        }
+
+        sink.flush();
+        REQUIRE(wait_for([&]() { return sink.stats().spooled == 100; }));
+        REQUIRE(sink.stats().sent == 0);
+
+        REQUIRE(::listen(listener, 1) == 0);
+        collector = std::thread([&]() { received = read_all(listener); });
+
+        REQUIRE(wait_for([&]() { return sink.stats().sent == 100; }));
+        REQUIRE(sink.stats().dropped == 0);
+    }
+
+    collector.join();
+    ::close(listener);
+    std::remove(spool_file);
+
+    REQUIRE(received == expected);
+}
+
+TEST_CASE("Network sink discards a corrupt spool file", "[log]")
+{
+    const char* spool_file = "test_network_corrupt_spool.bin";
+
+    {
+        // a valid batch, followed by a header claiming far more data than the file holds
+        std::ofstream spool(spool_file, std::ios::binary | std::ios::trunc);
+
+        std::uint32_t header[2] = { 11, 1 };
+        spool.write(reinterpret_cast<const char*>(header), sizeof(header));
+        spool << "old record\n";
+
+        header[0] = 0xffffffff;
+        spool.write(reinterpret_cast<const char*>(header), sizeof(header));
+        spool << "garbage";
+    }
+
+    std::uint16_t port;
+    int listener = bind_loopback(SOCK_STREAM, port);
+    REQUIRE(::listen(listener, 1) == 0);
+
+    std::string received;
+    std::thread collector([&]() { received = read_all(listener); });
+
+    nitro::log::sink::network_options options;
+    options.port = port;
+    options.spool_file = spool_file;
+
+    {
+        nitro::log::sink::Network sink(options);
+
+        sink.sink(nitro::log::severity_level::info, record(0));
+        sink.flush();
+
+        REQUIRE(wait_for([&]() { return sink.stats().sent == 2; }));
+    }
+
+    collector.join();
+    ::close(listener);
+
+    std::ifstream spool(spool_file, std::ios::ate);
+    REQUIRE(spool.tellg() == 0);
+    std::remove(spool_file);
+
+    REQUIRE(received == "old record\n" + record(0));
+}
+
+TEST_CASE("Network sink gives up connecting to a host, which does not answer", "[log]")
+{
+    // with a full accept queue, further connection requests are ignored like by a black hole
+    std::uint16_t port;
+    int listener = bind_loopback(SOCK_STREAM, port);
+    REQUIRE(::listen(listener, 0) == 0);
+
+    int queued = ::socket(AF_INET, SOCK_STREAM, 0);
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    addr.sin_port = htons(port);
+    REQUIRE(::connect(queued, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) == 0);
+
+    nitro::log::sink::network_options options;
+    options.port = port;
+    options.connect_timeout = std::chrono::milliseconds(100);
+
+    auto begin = std::chrono::steady_clock::now();
+
+    {
+        nitro::log::sink::Network sink(options);
+        sink.sink(nitro::log::severity_level::info, record(0));
+        sink.flush();
+    }
+
+    auto duration = std::chrono::steady_clock::now() - begin;
+
+    ::close(queued);
+    ::close(listener);
+
+    REQUIRE(duration < std::chrono::seconds(5));
+}
+
+TEST_CASE("Network sink drops records beyond the memory spool", "[log]")
+{
+    std::uint16_t port;
+    int listener = bind_loopback(SOCK_STREAM, port);
+
+    nitro::log::sink::network_options options;
+    options.port = port;
+    options.batch_size = 16;
+    options.memory_spool_size = 64;
+    options.min_backoff = std::chrono::milliseconds(1000);
+
+    nitro::log::sink::network_stats stats;
+
+    {
+        nitro::log::sink::Network sink(options);
+
+        for (int i = 0; i < 100; ++i)
+        {
+            sink.sink(nitro::log::severity_level::info, record(i));
+        }
+
+        REQUIRE(sink.stats().dropped > 0);
+        stats = sink.stats();
+    }
+
+    ::close(listener);
+
+    REQUIRE(stats.sent == 0);
+    REQUIRE(stats.spooled == 0);
+}
@@ -0,0 +1,154 @@
+#include <catch2/catch.hpp>
+
+#include <nitro/log/sink/stdout_omp_buffered.hpp>
+
+#include <iostream>
+#include <set>
+#include <sstream>
+#include <string>
+
+#include <omp.h>
+
+namespace
+{
+class capture_stdout
+{
+public:
+    capture_stdout() : old_(std::cout.rdbuf(out_.rdbuf()))
+    {
+    }
+
+    ~capture_stdout()
+    {
+        std::cout.rdbuf(old_);
+    }
+
+    std::string str() const
+    {
+        return out_.str();
+    }
+
+private:
+    std::stringstream out_;
+    std::streambuf* old_;
+};
+
+std::set<std::string> lines(const std::string& text)
+{
+    std::set<std::string> result;
+    std::istringstream in(text);
+
+    for (std::string line; std::getline(in, line);)
+    {
+        result.insert(line);
+    }
+
+    return result;
+}
+} // namespace
+
+TEST_CASE("Buffered OpenMP sink writes records of a parallel region in bulk", "[log]")
+{
+    capture_stdout out;
+    nitro::log::sink::StdOutOmpBuffered<> sink;
+
+#pragma omp parallel for num_threads(4)
+    for (int i = 0; i < 1000; ++i)
+    {
+        sink.sink(nitro::log::severity_level::info, "record " + std::to_string(i) + "\n");
+    }
+
+    REQUIRE(out.str().empty());
+
+    sink.flush();
+
+    auto result = lines(out.str());
+    REQUIRE(result.size() == 1000);
+    REQUIRE(result.count("record 0") == 1);
+    REQUIRE(result.count("record 999") == 1);
+}
+
+TEST_CASE("Buffered OpenMP sink writes full buffers and errors immediately", "[log]")
+{
+    capture_stdout out;
+    nitro::log::sink::StdOutOmpBuffered<> sink;
+
+    SECTION("Full buffers")
+    {
+        auto old_size = nitro::log::sink::StdOutOmpBuffered<>::buffer_size();
+        nitro::log::sink::StdOutOmpBuffered<>::buffer_size() = 1;
+
+#pragma omp parallel num_threads(2)
+        {
+            sink.sink(nitro::log::severity_level::info, "record\n");
+        }
+
+        nitro::log::sink::StdOutOmpBuffered<>::buffer_size() = old_size;
+
+        REQUIRE(out.str() == "record\nrecord\n");
+    }
+
+    SECTION("Errors")
+    {
+#pragma omp parallel num_threads(2)
+        {
+            sink.sink(nitro::log::severity_level::error, "error\n");
+        }
+
+        REQUIRE(out.str() == "error\nerror\n");
+    }
+}
+
+TEST_CASE("Buffered OpenMP sink keeps the order around parallel regions", "[log]")
+{
+    capture_stdout out;
+    nitro::log::sink::StdOutOmpBuffered<true> sink;
+
+    sink.sink(nitro::log::severity_level::info, "before\n");
+
+#pragma omp parallel num_threads(1)
+    {
+        sink.sink(nitro::log::severity_level::info, "inside\n");
+    }
+
+    sink.sink(nitro::log::severity_level::info, "after\n");
+
+    REQUIRE(out.str() == "[omp 0] before\n[omp 0] inside\n[omp 0] after\n");
+}
+
+TEST_CASE("Buffered OpenMP sink separates the threads of inactive nested regions", "[log]")
+{
+    capture_stdout out;
+    nitro::log::sink::StdOutOmpBuffered<true> sink;
+
+    auto max_active_levels = omp_get_max_active_levels();
+    omp_set_max_active_levels(1);
+
+#pragma omp parallel num_threads(4)
+    {
+        auto thread = std::to_string(omp_get_thread_num());
+
+#pragma omp parallel num_threads(2)
+        {
+            for (int i = 0; i < 100; ++i)
+            {
+                sink.sink(nitro::log::severity_level::info,
+                          thread + " " + std::to_string(i) + "\n");
+            }
+        }
+    }
+
+    omp_set_max_active_levels(max_active_levels);
+
+    sink.flush();
+
+    auto result = lines(out.str());
+    REQUIRE(result.size() == 4 * 100);
+
+    // every record is prefixed with the number of the thread, which logged it
+    for (auto& line : result)
+    {
+        auto thread = line.substr(5, line.find(']') - 5);
+        REQUIRE(line.find("] " + thread + " ") == thread.size() + 5);
+    }
+}
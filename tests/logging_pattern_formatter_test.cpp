@@ -0,0 +1,64 @@
+#include <catch2/catch.hpp>
+
+#include <test_sinks.hpp>
+
+#include <nitro/log/attribute/message.hpp>
+#include <nitro/log/attribute/pid.hpp>
+#include <nitro/log/attribute/severity.hpp>
+#include <nitro/log/attribute/tag.hpp>
+#include <nitro/log/attribute/timestamp.hpp>
+#include <nitro/log/filter/severity_filter.hpp>
+#include <nitro/log/formatter/pattern_formatter.hpp>
+#include <nitro/log/log.hpp>
+
+#include <string>
+#include <vector>
+
+namespace detail
+{
+typedef nitro::log::record<nitro::log::tag_attribute, nitro::log::message_attribute,
+                           nitro::log::severity_attribute, nitro::log::timestamp_attribute,
+                           nitro::log::pid_attribute>
+    record;
+
+constexpr char pattern[] = "[%d][%s][%t] %p/%i: %m 100%%\n";
+constexpr char message_only[] = "%m";
+
+template <typename Record>
+using formatter = nitro::log::formatter::pattern_formatter<Record, pattern>;
+
+template <typename Record>
+using log_filter = nitro::log::filter::severity_filter<Record>;
+} // namespace detail
+
+using logging =
+    nitro::log::logger<detail::record, detail::formatter, detail::vector_sink, detail::log_filter>;
+
+TEST_CASE("Pattern formatter emits the attributes of the pattern", "[log]")
+{
+    detail::record r;
+    r.tag() = "tag";
+    r.severity() = nitro::log::severity_level::warn;
+    r.message() = "message";
+
+    auto expected = "[" + std::to_string(r.timestamp().time_since_epoch().count()) +
+                    "][ WARN][tag] " + std::to_string(r.pid()) + "/" + std::to_string(r.tid()) +
+                    ": message 100%\n";
+
+    CHECK(detail::formatter<detail::record>().format(r) == expected);
+    CHECK(nitro::log::formatter::pattern_formatter<detail::record, detail::message_only>().format(
+              r) == "message");
+}
+
+TEST_CASE("Pattern formatter works with the logger", "[log]")
+{
+    detail::vector_sink::records().clear();
+
+    logging::error("tag") << "value: " << 42;
+
+    REQUIRE(detail::vector_sink::records().size() == 1);
+
+    const auto& record = detail::vector_sink::records()[0];
+    CHECK(record.find("][ERROR][tag] ") != std::string::npos);
+    CHECK(record.find(": value: 42 100%\n") != std::string::npos);
+}
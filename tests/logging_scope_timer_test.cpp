@@ -0,0 +1,160 @@
+#include <catch2/catch.hpp>
+
+#include <test_sinks.hpp>
+
+#include <nitro/log/attribute/message.hpp>
+#include <nitro/log/attribute/severity.hpp>
+#include <nitro/log/attribute/tag.hpp>
+#include <nitro/log/attribute/timestamp.hpp>
+#include <nitro/log/filter/severity_filter.hpp>
+#include <nitro/log/log.hpp>
+#include <nitro/log/scope_timer.hpp>
+
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace detail
+{
+typedef nitro::log::record<nitro::log::tag_attribute, nitro::log::message_attribute,
+                           nitro::log::severity_attribute, nitro::log::timestamp_attribute>
+    record;
+
+template <typename Record>
+class tag_formater
+{
+public:
+    std::string format(Record& r)
+    {
+        return r.tag() + ": " + r.message();
+    }
+};
+
+template <typename Record>
+using log_filter = nitro::log::filter::severity_filter<Record>;
+} // namespace detail
+
+using logging = nitro::log::logger<detail::record, detail::tag_formater, detail::vector_sink,
+                                   detail::log_filter>;
+
+TEST_CASE("Timer histograms have a bounded relative error", "[log]")
+{
+    nitro::log::detail::timer_histogram histogram;
+
+    for (std::uint64_t value = 1; value <= 100000; ++value)
+    {
+        histogram.record(value);
+    }
+
+    CHECK(histogram.count() == 100000);
+    CHECK(histogram.min() == 1);
+    CHECK(histogram.max() == 100000);
+
+    auto p50 = histogram.quantile(0.5);
+    auto p99 = histogram.quantile(0.99);
+
+    CHECK(p50 >= 50000);
+    CHECK(p50 <= 50000 + 50000 / 16);
+    CHECK(p99 >= 99000);
+    CHECK(p99 <= 100000);
+
+    for (std::uint64_t value : { 0ull, 31ull, 32ull, 1000ull, 123456789ull, ~0ull })
+    {
+        auto index = nitro::log::detail::timer_histogram::index(value);
+        REQUIRE(index < nitro::log::detail::timer_histogram::bucket_count);
+        CHECK(nitro::log::detail::timer_histogram::highest_value(index) >= value);
+        CHECK(nitro::log::detail::timer_histogram::highest_value(index) - value <= value / 16);
+    }
+}
+
+TEST_CASE("Scope timers emit summaries", "[log]")
+{
+    std::vector<nitro::log::timer_summary> summaries;
+    nitro::log::set_timer_reporter(
+        [&summaries](const nitro::log::timer_summary& summary) { summaries.push_back(summary); });
+
+    SECTION("Summaries are emitted on flush")
+    {
+        for (int i = 0; i < 3; ++i)
+        {
+            nitro::log::scope_timer timer("test timer");
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+
+        CHECK(summaries.empty());
+
+        nitro::log::flush_timers();
+
+        REQUIRE(summaries.size() == 1);
+        CHECK(summaries[0].tag == "test timer");
+        CHECK(summaries[0].count == 3);
+        CHECK(summaries[0].min >= std::chrono::milliseconds(1));
+        CHECK(summaries[0].min <= summaries[0].p50);
+        CHECK(summaries[0].p50 <= summaries[0].p99);
+        CHECK(summaries[0].p99 <= summaries[0].max);
+
+        nitro::log::flush_timers();
+        CHECK(summaries.size() == 1);
+    }
+
+    SECTION("Summaries are keyed by the contents of the tag")
+    {
+        for (int i = 0; i < 2; ++i)
+        {
+            std::string tag = "dynamic timer";
+            nitro::log::scope_timer timer(tag.c_str());
+        }
+
+        {
+            nitro::log::scope_timer timer("dynamic timer");
+        }
+
+        nitro::log::flush_timers();
+
+        REQUIRE(summaries.size() == 1);
+        CHECK(summaries[0].tag == "dynamic timer");
+        CHECK(summaries[0].count == 3);
+    }
+
+    SECTION("Summaries are emitted periodically")
+    {
+        nitro::log::set_timer_interval(std::chrono::nanoseconds(0));
+
+        {
+            nitro::log::scope_timer timer("test timer");
+        }
+
+        nitro::log::set_timer_interval(std::chrono::seconds(10));
+
+        REQUIRE(summaries.size() == 1);
+        CHECK(summaries[0].count == 1);
+    }
+
+    SECTION("Summaries are emitted on thread exit")
+    {
+        std::thread t([]() { nitro::log::scope_timer timer("thread timer"); });
+        t.join();
+
+        REQUIRE(summaries.size() == 1);
+        CHECK(summaries[0].tag == "thread timer");
+        CHECK(summaries[0].count == 1);
+    }
+
+    SECTION("Summaries can be logged")
+    {
+        nitro::log::report_timers_to<logging>();
+        detail::vector_sink::records().clear();
+
+        {
+            nitro::log::scope_timer timer("test timer");
+        }
+
+        nitro::log::flush_timers();
+
+        REQUIRE(detail::vector_sink::records().size() == 1);
+        CHECK(detail::vector_sink::records()[0].find("test timer: count=1 min=") == 0);
+    }
+
+    nitro::log::set_timer_reporter(nullptr);
+}
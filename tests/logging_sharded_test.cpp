@@ -0,0 +1,247 @@
+#include <catch2/catch.hpp>
+
+#include <nitro/log/merge.hpp>
+#include <nitro/log/sink/sharded_logfile.hpp>
+
+#include <nitro/env/process.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+std::string read_file(const std::string& name)
+{
+    std::ifstream in(name);
+    std::stringstream str;
+    str << in.rdbuf();
+    return str.str();
+}
+} // namespace
+
+TEST_CASE("Sharded logfile names expand placeholders", "[log]")
+{
+    nitro::log::rank_attribute::initialize(3);
+    nitro::log::sink::ShardedLogfile::log_file() = "log.{rank}.{pid}.{rank}.txt";
+
+    auto pid = std::to_string(nitro::env::get_pid());
+
+    REQUIRE(nitro::log::sink::ShardedLogfile::file_name() == "log.3." + pid + ".3.txt");
+}
+
+TEST_CASE("Sharded logfile writes one file per thread", "[log]")
+{
+    nitro::log::sink::ShardedLogfile::log_file() = "test_shard.{pid}.{tid}.txt";
+
+    nitro::log::sink::ShardedLogfile sink;
+
+    std::atomic<int> clock(0);
+    std::vector<std::string> files(4);
+    std::vector<std::thread> threads;
+
+    for (int t = 0; t < 4; ++t)
+    {
+        threads.emplace_back([&, t]() {
+            files[t] = nitro::log::sink::ShardedLogfile::file_name();
+
+            for (int i = 0; i < 100; ++i)
+            {
+                sink.sink(nitro::log::severity_level::info,
+                          "[" + std::to_string(clock++) + "] thread " + std::to_string(t) + "\n");
+            }
+        });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    for (int t = 0; t < 4; ++t)
+    {
+        auto content = read_file(files[t]);
+
+        REQUIRE(std::count(content.begin(), content.end(), '\n') == 100);
+        REQUIRE(content.find("thread " + std::to_string(t) + "\n") != std::string::npos);
+    }
+
+    std::stringstream merged;
+    nitro::log::merge_logfiles(files, merged);
+
+    std::string line;
+    std::int64_t expected = 0;
+    while (std::getline(merged, line))
+    {
+        std::int64_t timestamp;
+        REQUIRE(nitro::log::leading_timestamp(line.data(), line.size(), timestamp));
+        REQUIRE(timestamp == expected++);
+    }
+
+    REQUIRE(expected == 400);
+
+    for (auto& file : files)
+    {
+        std::remove(file.c_str());
+    }
+}
+
+TEST_CASE("Sharded logfile instances write their own per-thread files", "[log]")
+{
+    auto pid = std::to_string(nitro::env::get_pid());
+    auto file = [&pid](const std::string& name, const std::string& tid) {
+        return "test_shard_" + name + "." + pid + "." + tid + ".txt";
+    };
+
+    std::string thread_tid;
+    auto main_tid = std::to_string(nitro::env::get_tid());
+
+    {
+        nitro::log::sink::ShardedLogfile first("test_shard_first.{pid}.{tid}.txt");
+        nitro::log::sink::ShardedLogfile second("test_shard_second.{pid}.{tid}.txt");
+
+        std::thread thread([&]() {
+            thread_tid = std::to_string(nitro::env::get_tid());
+
+            first.sink(nitro::log::severity_level::info, "[1] first\n");
+            second.sink(nitro::log::severity_level::info, "[2] second\n");
+            first.sink(nitro::log::severity_level::info, "[3] first\n");
+        });
+        thread.join();
+
+        // closed when the thread exited
+        REQUIRE(read_file(file("first", thread_tid)) == "[1] first\n[3] first\n");
+        REQUIRE(read_file(file("second", thread_tid)) == "[2] second\n");
+
+        first.sink(nitro::log::severity_level::info, "[4] first\n");
+    }
+
+    // closed by the destructor of the sink
+    REQUIRE(read_file(file("first", main_tid)) == "[4] first\n");
+
+    std::remove(file("first", thread_tid).c_str());
+    std::remove(file("second", thread_tid).c_str());
+    std::remove(file("first", main_tid).c_str());
+}
+
+TEST_CASE("Merging logfiles keeps multi-line records together", "[log]")
+{
+    {
+        std::ofstream a("test_merge_a.txt");
+        a << "header\n[1] a\n[4] b\ncontinued\n";
+
+        std::ofstream b("test_merge_b.txt");
+        b << "[2] c\n[3] d\n[4] e\n";
+    }
+
+    std::stringstream merged;
+    nitro::log::merge_logfiles({ "test_merge_a.txt", "test_merge_b.txt" }, merged);
+
+    REQUIRE(merged.str() == "header\n[1] a\n[2] c\n[3] d\n[4] b\ncontinued\n[4] e\n");
+
+    REQUIRE_THROWS(nitro::log::merge_logfiles({ "test_merge_missing.txt" }, merged));
+
+    std::remove("test_merge_a.txt");
+    std::remove("test_merge_b.txt");
+}
+
+TEST_CASE("Merging logfiles with a timestamp prefix into a file", "[log]")
+{
+    {
+        std::ofstream a("test_merge_prefix_a.txt");
+        a << "ts=10 a\nts=30 b\nts=50 c";
+
+        std::ofstream b("test_merge_prefix_b.txt");
+        b << "ts=20 d\nts=40 e\n";
+
+        std::ofstream c("test_merge_prefix_c.txt");
+    }
+
+    nitro::log::merge_logfiles(
+        { "test_merge_prefix_a.txt", "test_merge_prefix_b.txt", "test_merge_prefix_c.txt" },
+        std::string("test_merge_prefix_out.txt"), nitro::log::prefixed_timestamp("ts="));
+
+    REQUIRE(read_file("test_merge_prefix_out.txt") ==
+            "ts=10 a\nts=20 d\nts=30 b\nts=40 e\nts=50 c\n");
+
+    std::remove("test_merge_prefix_a.txt");
+    std::remove("test_merge_prefix_b.txt");
+    std::remove("test_merge_prefix_c.txt");
+    std::remove("test_merge_prefix_out.txt");
+}
+
+TEST_CASE("Timestamp parsers reject numbers beyond 64 bits", "[log]")
+{
+    auto parse = [](const std::string& line, std::int64_t& timestamp) {
+        return nitro::log::leading_timestamp(line.data(), line.size(), timestamp);
+    };
+
+    std::int64_t timestamp = 0;
+
+    REQUIRE(parse("[9223372036854775807][ INFO]", timestamp));
+    REQUIRE(timestamp == std::numeric_limits<std::int64_t>::max());
+
+    REQUIRE(parse("-9223372036854775808 x", timestamp));
+    REQUIRE(timestamp == std::numeric_limits<std::int64_t>::min());
+
+    REQUIRE(!parse("[9223372036854775808][ INFO]", timestamp));
+    REQUIRE(!parse("-9223372036854775809", timestamp));
+    REQUIRE(!parse(std::string(40, '9'), timestamp));
+
+    // only the given range is parsed
+    REQUIRE(nitro::log::leading_timestamp("12345", 3, timestamp));
+    REQUIRE(timestamp == 123);
+
+    auto prefixed = nitro::log::prefixed_timestamp("ts=");
+    REQUIRE(prefixed("ts=-42 x", 8, timestamp));
+    REQUIRE(timestamp == -42);
+    REQUIRE(!prefixed("ts", 2, timestamp));
+    REQUIRE(!prefixed("ts=99999999999999999999", 23, timestamp));
+}
+
+TEST_CASE("Merging many logfiles keeps the order of equal timestamps", "[log]")
+{
+    std::vector<std::string> files;
+
+    for (int f = 0; f < 16; ++f)
+    {
+        files.push_back("test_merge_many_" + std::to_string(f) + ".txt");
+        std::ofstream out(files.back());
+
+        for (int i = f % 3; i < 300; i += 3)
+        {
+            out << "[" << i / 10 << "] " << f << " " << i << "\n";
+        }
+    }
+
+    std::stringstream merged;
+    nitro::log::merge_logfiles(files, merged);
+
+    std::pair<std::int64_t, int> last(0, 0);
+    std::size_t lines = 0;
+    std::string line;
+    while (std::getline(merged, line))
+    {
+        std::pair<std::int64_t, int> current;
+        REQUIRE(nitro::log::leading_timestamp(line.data(), line.size(), current.first));
+        current.second = std::stoi(line.substr(line.find(' ') + 1));
+
+        REQUIRE(last <= current);
+        last = current;
+        ++lines;
+    }
+
+    REQUIRE(lines == 16 * 100);
+
+    for (auto& file : files)
+    {
+        std::remove(file.c_str());
+    }
+}
@@ -0,0 +1,298 @@
+#include <catch2/catch.hpp>
+
+#include <nitro/log/attribute/message.hpp>
+#include <nitro/log/attribute/timestamp.hpp>
+#include <nitro/log/log.hpp>
+#include <nitro/log/shm_collector.hpp>
+#include <nitro/log/sink/shared_memory.hpp>
+
+#include <chrono>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+extern "C"
+{
+#include <sys/wait.h>
+#include <unistd.h>
+}
+
+namespace detail
+{
+typedef nitro::log::record<nitro::log::message_attribute, nitro::log::timestamp_attribute> record;
+
+template <typename Record>
+class message_formater
+{
+public:
+    std::string format(Record& r)
+    {
+        return r.message() + "\n";
+    }
+};
+
+template <typename Record>
+class accept_all
+{
+public:
+    typedef Record record_type;
+
+    bool filter(Record&) const
+    {
+        return true;
+    }
+};
+} // namespace detail
+
+using logging = nitro::log::logger<detail::record, detail::message_formater,
+                                   nitro::log::sink::SharedMemory, detail::accept_all>;
+
+namespace
+{
+std::string segment_name(const std::string& suffix)
+{
+    return "/nitro-log-test-" + std::to_string(::getpid()) + "-" + suffix;
+}
+
+std::string read_file(const std::string& name)
+{
+    std::ifstream file(name);
+    std::stringstream content;
+    content << file.rdbuf();
+    return content.str();
+}
+
+bool children_running(const std::vector<pid_t>& children)
+{
+    for (auto child : children)
+    {
+        if (::waitpid(child, nullptr, WNOHANG) == 0)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+} // namespace
+
+TEST_CASE("Shared memory sink collects the records of several processes", "[log]")
+{
+    auto segment = segment_name("multi");
+    auto file_name = "nitro_shm_test.multi.txt";
+
+    nitro::log::shm_collector::remove(segment);
+    std::remove(file_name);
+
+    nitro::log::shm_collector collector(segment, file_name);
+
+    const std::string long_record(1000, 'x');
+
+    std::vector<pid_t> children;
+    for (int child = 0; child < 4; ++child)
+    {
+        auto pid = ::fork();
+        REQUIRE(pid >= 0);
+
+        if (pid == 0)
+        {
+            nitro::log::sink::SharedMemory::segment_name() = segment;
+
+            for (int i = 0; i < 500; ++i)
+            {
+                logging::info() << "child " << child << " record " << i;
+            }
+            logging::info() << long_record;
+
+            ::_exit(0);
+        }
+
+        children.push_back(pid);
+    }
+
+    std::size_t records = 0;
+    while (children_running(children))
+    {
+        records += collector.drain();
+    }
+    records += collector.drain();
+
+    CHECK(records == 4 * 501);
+    CHECK(collector.dropped() == 0);
+    CHECK(collector.lost() == 0);
+
+    auto content = read_file(file_name);
+    std::stringstream lines(content);
+    std::string line;
+    std::size_t count = 0;
+    std::size_t long_records = 0;
+    while (std::getline(lines, line))
+    {
+        ++count;
+        if (line == long_record)
+        {
+            ++long_records;
+        }
+    }
+
+    CHECK(count == 4 * 501);
+    CHECK(long_records == 4);
+    CHECK(content.find("child 3 record 499\n") != std::string::npos);
+
+    nitro::log::shm_collector::remove(segment);
+    std::remove(file_name);
+}
+
+TEST_CASE("Shared memory collector skips records of crashed producers", "[log]")
+{
+    auto segment = segment_name("crash");
+    auto file_name = "nitro_shm_test.crash.txt";
+
+    nitro::log::shm_collector::remove(segment);
+    std::remove(file_name);
+
+    nitro::log::shm_collector collector(segment, file_name);
+    collector.stale_timeout() = std::chrono::milliseconds(10);
+
+    auto pid = ::fork();
+    REQUIRE(pid >= 0);
+
+    if (pid == 0)
+    {
+        // claim three slots and die before publishing them
+        nitro::log::detail::shm_ring ring(segment, 4096);
+
+        std::uint64_t pos;
+        std::uint16_t count;
+        ring.claim(600, pos, count);
+
+        ::_exit(1);
+    }
+
+    ::waitpid(pid, nullptr, 0);
+
+    {
+        nitro::log::detail::shm_ring ring(segment, 4096);
+        std::string record = "after crash\n";
+        REQUIRE(ring.push(record.data(), record.size()));
+    }
+
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    std::size_t records = 0;
+    while (records == 0 && std::chrono::steady_clock::now() < deadline)
+    {
+        records += collector.drain();
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    CHECK(records == 1);
+    CHECK(collector.lost() == 3);
+    CHECK(read_file(file_name) == "after crash\n");
+
+    nitro::log::shm_collector::remove(segment);
+    std::remove(file_name);
+}
+
+TEST_CASE("Shared memory collector waits for slow producers", "[log]")
+{
+    auto segment = segment_name("slow");
+    auto file_name = "nitro_shm_test.slow.txt";
+
+    nitro::log::shm_collector::remove(segment);
+    std::remove(file_name);
+
+    nitro::log::shm_collector collector(segment, file_name);
+    collector.stale_timeout() = std::chrono::milliseconds(1);
+
+    nitro::log::detail::shm_ring ring(segment, 4096);
+
+    std::string record(300, 'x');
+    record += "\n";
+
+    std::uint64_t pos;
+    std::uint16_t count;
+    REQUIRE(ring.claim(record.size(), pos, count));
+
+    for (int i = 0; i < 10; ++i)
+    {
+        CHECK(collector.drain() == 0);
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+
+    CHECK(collector.lost() == 0);
+    REQUIRE(ring.publish(pos, count, record.data(), record.size()));
+    CHECK(collector.drain() == 1);
+    CHECK(read_file(file_name) == record);
+
+    nitro::log::shm_collector::remove(segment);
+    std::remove(file_name);
+}
+
+TEST_CASE("Shared memory ring continues after a consumer stopped mid-drain", "[log]")
+{
+    auto segment = segment_name("restart");
+
+    nitro::log::shm_collector::remove(segment);
+
+    std::string record = "record\n";
+
+    {
+        nitro::log::detail::shm_ring ring(segment, 8);
+
+        for (int i = 0; i < 4; ++i)
+        {
+            REQUIRE(ring.push(record.data(), record.size()));
+        }
+
+        int consumed = 0;
+        auto stop_after_one = [&consumed](const std::string&) {
+            if (consumed++ == 1)
+            {
+                throw std::runtime_error("collector stopped");
+            }
+        };
+
+        REQUIRE_THROWS(ring.drain(stop_after_one, std::chrono::seconds(1)));
+    }
+
+    // a new consumer delivers the remaining records, including the interrupted one
+    nitro::log::detail::shm_ring ring(segment, 8);
+
+    std::size_t records = ring.drain([](const std::string&) {}, std::chrono::seconds(1));
+    CHECK(records == 3);
+    CHECK(ring.lost() == 0);
+
+    for (int i = 0; i < 8; ++i)
+    {
+        CHECK(ring.push(record.data(), record.size()));
+    }
+
+    nitro::log::shm_collector::remove(segment);
+}
+
+TEST_CASE("Shared memory sink drops records if the ring is full", "[log]")
+{
+    auto segment = segment_name("full");
+
+    nitro::log::shm_collector::remove(segment);
+
+    nitro::log::detail::shm_ring ring(segment, 4);
+    std::string record = "record\n";
+
+    for (int i = 0; i < 4; ++i)
+    {
+        CHECK(ring.push(record.data(), record.size()));
+    }
+
+    CHECK(!ring.push(record.data(), record.size()));
+    CHECK(ring.dropped() == 1);
+
+    std::size_t records = ring.drain([](const std::string&) {}, std::chrono::seconds(1));
+    CHECK(records == 4);
+
+    CHECK(ring.push(record.data(), record.size()));
+
+    nitro::log::shm_collector::remove(segment);
+}
@@ -0,0 +1,126 @@
+#include <catch2/catch.hpp>
+
+#include <test_sinks.hpp>
+
+#include <nitro/log/attribute/message.hpp>
+#include <nitro/log/attribute/severity.hpp>
+#include <nitro/log/attribute/stacktrace.hpp>
+#include <nitro/log/attribute/timestamp.hpp>
+#include <nitro/log/filter/severity_filter.hpp>
+#include <nitro/log/formatter/pattern_formatter.hpp>
+#include <nitro/log/log.hpp>
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace detail
+{
+typedef nitro::log::record<nitro::log::message_attribute, nitro::log::severity_attribute,
+                           nitro::log::timestamp_attribute, nitro::log::stacktrace_attribute>
+    record;
+
+constexpr char pattern[] = "[%s]: %m%S";
+
+template <typename Record>
+using formatter = nitro::log::formatter::pattern_formatter<Record, pattern>;
+
+template <typename Record>
+using log_filter = nitro::log::filter::severity_filter<Record>;
+} // namespace detail
+
+using logging = nitro::log::logger<detail::record, detail::formatter, detail::vector_sink,
+                                   detail::log_filter>;
+
+// the executable is linked with -rdynamic, so dladdr() finds this function
+__attribute__((noinline)) void nitro_stacktrace_test_failing_function(int i)
+{
+    logging::error() << "failure " << i;
+    asm volatile("");
+}
+
+TEST_CASE("stack traces are captured for error records", "[log]")
+{
+    detail::vector_sink::records().clear();
+
+    logging::info() << "no trace";
+    nitro_stacktrace_test_failing_function(1);
+
+    auto& records = detail::vector_sink::records();
+    REQUIRE(records.size() == 2);
+
+    REQUIRE(records[0] == "[ INFO]: no trace");
+
+    // the frames of the logger are skipped
+    REQUIRE(records[1].find("[ERROR]: failure 1\n"
+                            "  #0 nitro_stacktrace_test_failing_function(int)+0x") == 0);
+}
+
+TEST_CASE("stack trace symbols are cached", "[log]")
+{
+    nitro::log::stacktrace trace;
+    trace.capture();
+
+    REQUIRE(!trace.empty());
+
+    std::ostringstream first;
+    first << trace;
+    auto cached = nitro::log::detail::symbol_cache::instance().size();
+
+    std::ostringstream second;
+    second << trace;
+
+    REQUIRE(nitro::log::detail::symbol_cache::instance().size() == cached);
+    REQUIRE(first.str() == second.str());
+    REQUIRE(first.str().find("\n  #0 ") == 0);
+}
+
+namespace
+{
+volatile int nitro_stacktrace_test_calls = 0;
+
+// deep enough, so that a full trace is available after skipping, unless the calls are merged
+void nitro_stacktrace_test_recurse(nitro::log::stacktrace& trace, int depth, int skip)
+{
+    if (depth == 0)
+    {
+        trace.capture(skip);
+        return;
+    }
+
+    nitro_stacktrace_test_recurse(trace, depth - 1, skip);
+
+    // prevents a tail call
+    nitro_stacktrace_test_calls = nitro_stacktrace_test_calls + 1;
+}
+} // namespace
+
+TEST_CASE("stack traces clamp the skipped frames", "[log]")
+{
+    const int max_frames = nitro::log::stacktrace::max_frames;
+
+    nitro::log::stacktrace all;
+    nitro_stacktrace_test_recurse(all, 64, 0);
+    REQUIRE(all.size() <= max_frames);
+
+    nitro::log::stacktrace skipped;
+    nitro_stacktrace_test_recurse(skipped, 64, 100);
+    REQUIRE(skipped.size() <= max_frames);
+    REQUIRE(skipped.size() > 0);
+}
+
+TEST_CASE("stack traces follow the minimum severity", "[log]")
+{
+    detail::vector_sink::records().clear();
+
+    nitro::log::stacktrace_attribute::min_severity() = nitro::log::severity_level::warn;
+    logging::warn() << "warning";
+    nitro::log::stacktrace_attribute::min_severity() = nitro::log::severity_level::fatal;
+    logging::error() << "error";
+    nitro::log::stacktrace_attribute::min_severity() = nitro::log::severity_level::error;
+
+    auto& records = detail::vector_sink::records();
+    REQUIRE(records.size() == 2);
+    REQUIRE(records[0].find("[ WARN]: warning\n  #0 ") == 0);
+    REQUIRE(records[1] == "[ERROR]: error");
+}
@@ -0,0 +1,137 @@
+#include <catch2/catch.hpp>
+
+#include <nitro/log/attribute/message.hpp>
+#include <nitro/log/attribute/severity.hpp>
+#include <nitro/log/attribute/timestamp.hpp>
+#include <nitro/log/filter/severity_filter.hpp>
+#include <nitro/log/log.hpp>
+#include <nitro/log/sink/null.hpp>
+#include <nitro/log/stats.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <sstream>
+#include <string>
+#include <thread>
+
+namespace detail
+{
+typedef nitro::log::record<nitro::log::message_attribute, nitro::log::severity_attribute,
+                           nitro::log::timestamp_attribute>
+    record;
+
+template <typename Record>
+class message_formater
+{
+public:
+    std::string format(Record& r)
+    {
+        return r.message() + "\n";
+    }
+};
+
+template <typename Record>
+using log_filter = nitro::log::filter::severity_filter<Record>;
+} // namespace detail
+
+using logging = nitro::log::logger<detail::record, detail::message_formater,
+                                   nitro::log::sink::Null, detail::log_filter>;
+
+TEST_CASE("Statistics count records, filtered records and bytes", "[log]")
+{
+    nitro::log::enable_stats();
+    nitro::log::reset_stats();
+    detail::log_filter<detail::record>::set_severity(nitro::log::severity_level::info);
+
+    logging::info() << "1234";
+    logging::warn() << "12";
+    logging::warn() << "1";
+    logging::debug() << "filtered";
+
+    auto stats = nitro::log::stats();
+
+    REQUIRE(stats.records_of(nitro::log::severity_level::info) == 1);
+    REQUIRE(stats.records_of(nitro::log::severity_level::warn) == 2);
+    REQUIRE(stats.records_of(nitro::log::severity_level::debug) == 0);
+    REQUIRE(stats.total_records() == 3);
+    REQUIRE(stats.filtered == 1);
+    REQUIRE(stats.bytes == 10);
+
+    std::uint64_t latencies = 0;
+    for (auto bucket : stats.latency)
+    {
+        latencies += bucket;
+    }
+    REQUIRE(latencies == 3);
+    REQUIRE(stats.latency_quantile(0.99) >= stats.latency_quantile(0.5));
+    REQUIRE(stats.latency_quantile(0.5).count() > 0);
+
+    std::stringstream str;
+    str << stats;
+    REQUIRE(str.str().find(" WARN=2") != std::string::npos);
+
+    detail::log_filter<detail::record>::set_severity(nitro::log::severity_level::trace);
+}
+
+TEST_CASE("Statistics keep the counts of exited threads", "[log]")
+{
+    nitro::log::enable_stats();
+    nitro::log::reset_stats();
+
+    std::thread([]() {
+        logging::error() << "from thread";
+        nitro::log::detail::stats_dropped(5);
+        nitro::log::detail::stats_queue_depth(7);
+        nitro::log::detail::stats_queue_depth(3);
+    }).join();
+
+    auto stats = nitro::log::stats();
+
+    REQUIRE(stats.records_of(nitro::log::severity_level::error) == 1);
+    REQUIRE(stats.dropped == 5);
+    REQUIRE(stats.queue_high_water == 7);
+}
+
+TEST_CASE("Latency quantiles are the upper bounds of their buckets", "[log]")
+{
+    nitro::log::statistics stats;
+
+    REQUIRE(stats.latency_quantile(1.0).count() == 0);
+
+    stats.latency[3] = 90;
+    stats.latency[10] = 10;
+
+    REQUIRE(stats.latency_quantile(0.0).count() == 16);
+    REQUIRE(stats.latency_quantile(0.5).count() == 16);
+    REQUIRE(stats.latency_quantile(0.9).count() == 2048);
+    REQUIRE(stats.latency_quantile(1.0).count() == 2048);
+}
+
+TEST_CASE("Statistics are not collected while disabled", "[log]")
+{
+    nitro::log::enable_stats(false);
+    nitro::log::reset_stats();
+
+    logging::info() << "not counted";
+
+    REQUIRE(nitro::log::stats().total_records() == 0);
+}
+
+TEST_CASE("Statistics are dumped periodically", "[log]")
+{
+    nitro::log::enable_stats();
+
+    std::atomic<int> dumps(0);
+
+    {
+        nitro::log::stats_dumper dumper(std::chrono::milliseconds(1),
+                                        [&dumps](const nitro::log::statistics&) { ++dumps; });
+
+        while (dumps < 2)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+
+    REQUIRE(dumps >= 2);
+}
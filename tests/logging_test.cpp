@@ -249,3 +249,114 @@ TEST_CASE("Logging lambdas works", "[log]")
         CHECK(i == 4);
     }
 }
+
+TEST_CASE("Logging lazy arguments works", "[log]")
+{
+    SECTION("Lazy arguments write into the stream")
+    {
+        std::stringstream str;
+        str << nitro::log::lazy([](std::ostream& os) { os << "test " << 43; });
+
+        CHECK(str.str() == "test 43");
+    }
+
+    SECTION("Lazy format captures its arguments by value")
+    {
+        std::string s = "test";
+        int i = 44;
+
+        auto arg = nitro::log::lazy_format("{} {}/{}", s, i, 1.5);
+        s = "changed";
+        i = 0;
+
+        std::stringstream str;
+        str << arg;
+
+        CHECK(str.str() == "test 44/1.5");
+    }
+
+    SECTION("Lazy format checks the number of placeholders")
+    {
+        std::stringstream str;
+
+        CHECK_THROWS(str << nitro::log::lazy_format("{} {}", 1));
+        CHECK_THROWS(str << nitro::log::lazy_format("{}", 1, 2));
+    }
+
+    SECTION("Evaluation of lazy arguments is lazy")
+    {
+        int i = 0;
+
+        auto count = [&i](std::ostream& os) { os << ++i; };
+
+        logging::fatal() << "test 45 " << nitro::log::lazy(count);
+        CHECK(i == 1);
+
+        logging::info() << "test 46 " << nitro::log::lazy(count);
+        CHECK(i == 2);
+
+        logging::debug() << "test 47 " << nitro::log::lazy(count);
+        CHECK(i == 2);
+
+        logging::trace() << nitro::log::lazy_format("test {} {}", 48, nitro::log::lazy(count));
+        CHECK(i == 2);
+
+        logging::warn() << nitro::log::lazy_format("test {} {}", 49, nitro::log::lazy(count));
+        CHECK(i == 3);
+    }
+}
+
+namespace detail
+{
+class flag_attribute
+{
+    char m_flag = 'x';
+
+public:
+    char& flag()
+    {
+        return m_flag;
+    }
+};
+
+class counter_attribute
+{
+    double m_counter = 0;
+
+public:
+    double& counter()
+    {
+        return m_counter;
+    }
+};
+
+typedef nitro::log::record<nitro::log::severity_attribute, nitro::log::timestamp_attribute,
+                           flag_attribute, counter_attribute, nitro::log::message_attribute>
+    padded_record;
+
+using padded_layout = nitro::log::record_layout<padded_record>;
+
+static_assert(padded_layout::padding() < 8, "attributes are sorted by alignment");
+static_assert(padded_layout::size() <= padded_layout::declared_size(),
+              "sorting never grows the record");
+} // namespace detail
+
+TEST_CASE("Records are stored without padding between attributes", "[log]")
+{
+    CHECK(detail::padded_layout::attributes_size() ==
+          sizeof(nitro::log::severity_attribute) + sizeof(nitro::log::timestamp_attribute) +
+              sizeof(detail::flag_attribute) + sizeof(detail::counter_attribute) +
+              sizeof(nitro::log::message_attribute));
+    CHECK(detail::padded_layout::saved() == 8);
+
+    detail::padded_record r;
+    nitro::log::severity_attribute& sev = r;
+    sev.severity() = nitro::log::severity_level::warn;
+    r.counter() = 1.5;
+    r.message() = "message";
+
+    CHECK(r.severity() == nitro::log::severity_level::warn);
+    CHECK(r.flag() == 'x');
+    CHECK(r.counter() == 1.5);
+    CHECK(std::string(r.message().data(), r.message().size()) == "message");
+}
@@ -0,0 +1,115 @@
+#include <catch2/catch.hpp>
+
+#include <nitro/log/sink/trace_event.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+
+namespace
+{
+struct pre_epoch_clock
+{
+    typedef std::chrono::nanoseconds duration;
+    typedef duration::rep rep;
+    typedef duration::period period;
+    typedef std::chrono::time_point<pre_epoch_clock> time_point;
+    static const bool is_steady = true;
+
+    static time_point now()
+    {
+        return time_point(duration(-1234005));
+    }
+};
+
+std::string read_file(const std::string& name)
+{
+    std::ifstream file(name);
+    std::stringstream content;
+    content << file.rdbuf();
+    return content.str();
+}
+
+std::size_t count(const std::string& str, const std::string& pattern)
+{
+    std::size_t result = 0;
+
+    for (auto pos = str.find(pattern); pos != std::string::npos;
+         pos = str.find(pattern, pos + pattern.size()))
+    {
+        ++result;
+    }
+
+    return result;
+}
+} // namespace
+
+TEST_CASE("Trace event sink writes the Chrome trace event format", "[log]")
+{
+    using trace = nitro::log::sink::TraceEvent<>;
+
+    trace::trace_file() = "nitro_trace_event_test.json";
+
+    {
+        trace::span span("outer");
+        trace::instant("marker");
+
+        std::thread t([]() {
+            trace::span span("thread");
+            trace sink;
+            sink.sink(nitro::log::severity_level::warn, "a \"quoted\" record\n");
+
+            // more than one chunk of events
+            for (int i = 0; i < 600; ++i)
+            {
+                trace::instant("tick");
+            }
+
+            sink.sink(nitro::log::severity_level::info, std::string(200, 'y') + "\n");
+        });
+        t.join();
+
+        trace::begin("inner");
+        trace::end("inner");
+    }
+
+    trace::flush();
+
+    auto json = read_file(trace::trace_file());
+
+    REQUIRE(json.size() > 0);
+    CHECK(json[0] == '[');
+
+    CHECK(count(json, "\"ph\":\"B\"") == 3);
+    CHECK(count(json, "\"ph\":\"E\"") == 3);
+    CHECK(count(json, "\"ph\":\"i\"") == 603);
+    CHECK(count(json, "{\"name\":\"tick\"") == 600);
+
+    // the text of log records is truncated
+    CHECK(count(json, "{\"name\":\"" + std::string(108, 'y') + "\",") == 1);
+
+    CHECK(count(json, "{\"name\":\"outer\",\"cat\":\"trace\",\"ph\":\"B\",\"ts\":") == 1);
+    CHECK(count(json, "{\"name\":\"a \\\"quoted\\\" record\",\"cat\":\"log\",\"ph\":\"i\"") == 1);
+    CHECK(count(json, "\"args\":{\"severity\":\"WARN\"") == 1);
+
+    // the events of the thread are written on its exit, before the ones of this thread
+    CHECK(json.find("\"thread\"") < json.find("\"outer\""));
+}
+
+TEST_CASE("Trace event sink writes timestamps before the epoch", "[log]")
+{
+    using trace = nitro::log::sink::TraceEvent<pre_epoch_clock>;
+
+    trace::trace_file() = "nitro_trace_event_test_pre_epoch.json";
+
+    trace::instant("early");
+    trace::flush();
+
+    auto json = read_file(trace::trace_file());
+    std::remove(trace::trace_file().c_str());
+
+    CHECK(count(json, "\"ts\":-1234.005,") == 1);
+}
@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2026, Technische Universität Dresden, Germany
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted
+ * provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+ *    and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to
+ *    endorse or promote products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ * WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <nitro/log/compressed_reader.hpp>
+
+#include <nitro/options/parser.hpp>
+
+#include <algorithm>
+#include <exception>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <thread>
+#include <vector>
+
+int main(int argc, char** argv)
+{
+    nitro::options::parser parser(
+        "nitro-logcat",
+        "Decompresses a log file written by the CompressedLogfile sink. The chunks are "
+        "decompressed in parallel and written in order.");
+
+    parser.option("from", "Skip chunks with records before this timestamp only").optional();
+    parser.option("to", "Skip chunks with records after this timestamp only").optional();
+    parser.option("jobs", "Number of decompression threads, 0 for one per core")
+        .short_name("j")
+        .default_value("0");
+
+    parser.accept_positionals(1);
+    parser.positional_metavar("logfile");
+
+    try
+    {
+        auto options = parser.parse(argc, argv);
+
+        if (options.positionals().size() != 1)
+        {
+            parser.usage(std::cerr);
+            return 1;
+        }
+
+        auto from = std::numeric_limits<std::int64_t>::min();
+        auto to = std::numeric_limits<std::int64_t>::max();
+
+        if (options.provided("from"))
+        {
+            from = std::stoll(options.get("from"));
+        }
+
+        if (options.provided("to"))
+        {
+            to = std::stoll(options.get("to"));
+        }
+
+        std::size_t jobs = std::stoul(options.get("jobs"));
+        if (jobs == 0)
+        {
+            jobs = std::max(1u, std::thread::hardware_concurrency());
+        }
+
+        nitro::log::compressed_log_reader reader(options.get(0));
+
+        std::vector<std::size_t> selected;
+        for (std::size_t i = 0; i < reader.chunks().size(); ++i)
+        {
+            auto& header = reader.chunks()[i].header;
+
+            if (header.last_timestamp >= from && header.first_timestamp <= to)
+            {
+                selected.push_back(i);
+            }
+        }
+
+        std::vector<std::string> buffers(jobs);
+        std::vector<std::exception_ptr> errors(jobs);
+
+        for (std::size_t begin = 0; begin < selected.size(); begin += jobs)
+        {
+            auto count = std::min(jobs, selected.size() - begin);
+            std::vector<std::thread> threads;
+
+            for (std::size_t j = 0; j < count; ++j)
+            {
+                threads.emplace_back([&, j]() {
+                    try
+                    {
+                        reader.read(selected[begin + j], buffers[j]);
+                    }
+                    catch (...)
+                    {
+                        errors[j] = std::current_exception();
+                    }
+                });
+            }
+
+            for (auto& thread : threads)
+            {
+                thread.join();
+            }
+
+            for (std::size_t j = 0; j < count; ++j)
+            {
+                if (errors[j])
+                {
+                    std::rethrow_exception(errors[j]);
+                }
+
+                std::cout.write(buffers[j].data(), buffers[j].size());
+            }
+        }
+    }
+    catch (std::exception& e)
+    {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2026, Technische Universität Dresden, Germany
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted
+ * provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+ *    and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to
+ *    endorse or promote products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ * WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <nitro/log/merge.hpp>
+
+#include <nitro/options/parser.hpp>
+
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <string>
+
+int main(int argc, char** argv)
+{
+    nitro::options::parser parser(
+        "nitro-logmerge",
+        "Merges log files, which are ordered by time each, e.g. the per-rank logs of a run, by "
+        "the timestamps of their records.");
+
+    parser.option("output", "Output file, the merged records are written to stdout otherwise")
+        .short_name("o")
+        .optional();
+    parser.option("prefix", "Prefix of the timestamp at the beginning of each record, by default "
+                            "the timestamp may be enclosed in brackets")
+        .short_name("p")
+        .optional();
+
+    parser.accept_positionals();
+    parser.positional_metavar("logfiles");
+
+    try
+    {
+        auto options = parser.parse(argc, argv);
+
+        if (options.positionals().empty())
+        {
+            parser.usage(std::cerr);
+            return 1;
+        }
+
+        const auto& inputs = options.positionals();
+
+        std::function<bool(const char*, std::size_t, std::int64_t&)> timestamp_parser =
+            nitro::log::leading_timestamp;
+
+        if (options.provided("prefix"))
+        {
+            timestamp_parser = nitro::log::prefixed_timestamp(options.get("prefix"));
+        }
+
+        if (options.provided("output"))
+        {
+            nitro::log::merge_logfiles(inputs, options.get("output"), timestamp_parser);
+        }
+        else
+        {
+            std::ios::sync_with_stdio(false);
+            nitro::log::merge_logfiles(inputs, std::cout, timestamp_parser);
+        }
+    }
+    catch (std::exception& e)
+    {
+        std::cerr << e.what() << std::endl;
+        parser.usage(std::cerr);
+        return 1;
+    }
+
+    return 0;
+}
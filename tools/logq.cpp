@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2026, Technische Universität Dresden, Germany
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted
+ * provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+ *    and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to
+ *    endorse or promote products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+ * WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <nitro/log/query.hpp>
+
+#include <nitro/options/parser.hpp>
+
+#include <iostream>
+#include <string>
+
+int main(int argc, char** argv)
+{
+    nitro::options::parser parser(
+        "nitro-logq",
+        "Prints the records of a log file matching a query. If the sidecar index <logfile>.idx "
+        "exists, only the blocks which may contain matching records are read.");
+
+    parser.option("from", "Minimum timestamp of the records").optional();
+    parser.option("to", "Maximum timestamp of the records").optional();
+    parser.option("severity", "Minimum severity of the records").short_name("s").default_value(
+        "trace");
+    parser.option("tag", "Tag of the records").short_name("t").optional();
+    parser.option("tag-field", "Index of the bracketed field containing the tag")
+        .default_value("1");
+
+    parser.accept_positionals(1);
+    parser.positional_metavar("logfile");
+
+    try
+    {
+        auto options = parser.parse(argc, argv);
+
+        if (options.positionals().size() != 1)
+        {
+            parser.usage(std::cerr);
+            return 1;
+        }
+
+        nitro::log::log_query query;
+
+        if (options.provided("from"))
+        {
+            query.from = std::stoll(options.get("from"));
+        }
+
+        if (options.provided("to"))
+        {
+            query.to = std::stoll(options.get("to"));
+        }
+
+        query.min_severity = nitro::log::severity_from_string(options.get("severity"),
+                                                              nitro::log::severity_level::trace);
+
+        nitro::log::log_index_options index_options;
+        index_options.tag_parser = nitro::log::bracketed_field(std::stoul(options.get("tag-field")));
+
+        if (options.provided("tag"))
+        {
+            query.tag = options.get("tag");
+        }
+
+        nitro::log::query_logfile(options.get(0), query, std::cout, index_options);
+    }
+    catch (std::exception& e)
+    {
+        std::cerr << e.what() << std::endl;
+        parser.usage(std::cerr);
+        return 1;
+    }
+
+    return 0;
+}